@@ -26,6 +26,7 @@
 #include "stdafx.h"
 #include "Body.h"
 #include "BFLMarker.h"
+#include "TriMesh.h"
 class PCpts;
 
 /// \brief	BFL body.
@@ -43,19 +44,22 @@ public:
 	~BFLBody(void);
 
 	// Custom constructor which takes pointer to point cloud data and a pointer to the grid owner for the labelling
-	BFLBody(GridObj *g, int bodyID, PCpts *_PCpts);
+	BFLBody(GridObj *g, int bodyID, PCpts *_PCpts, eMoveableType moveProperty);
+
+	// Custom constructor which also keeps the surface mesh the points were sampled from
+	BFLBody(GridObj *g, int bodyID, PCpts *_PCpts, eMoveableType moveProperty, const TriMesh &surface);
 
 	// Custom constructor for building prefab circle or sphere
-	BFLBody(GridObj* g, int bodyID, std::vector<double> &centre_point, double radius);
+	BFLBody(GridObj* g, int bodyID, std::vector<double> &centre_point, double radius, eMoveableType moveProperty);
 
 	// Custom constructor for building prefab filament
-	BFLBody(GridObj* g, int bodyID, std::vector<double> &centre_point, std::vector<double> &dimensions, std::vector<double> &angles);
+	BFLBody(GridObj* g, int bodyID, std::vector<double> &centre_point, std::vector<double> &dimensions, std::vector<double> &angles, eMoveableType moveProperty);
 
 	// Custom constructor for building prefab square or cuboid
-	BFLBody(GridObj* g, int bodyID, std::vector<double> &start_position, double length, std::vector<double> &angles);
+	BFLBody(GridObj* g, int bodyID, std::vector<double> &start_position, double length, std::vector<double> &angles, eMoveableType moveProperty);
 
 	// Custom constructor for building prefab plate
-	BFLBody(GridObj* g, int bodyID, std::vector<double> &centre_point, double length, double width, std::vector<double> &angles);
+	BFLBody(GridObj* g, int bodyID, std::vector<double> &centre_point, double length, double width, std::vector<double> &angles, eMoveableType moveProperty);
 
 protected:
 
@@ -68,17 +72,40 @@ protected:
 	///			ID.
 	std::vector<double>	Q;
 
+	bool isMovable;						///< Flag to indicate if body moves with the prescribed velocity
+	std::vector<double> uWall;			///< Prescribed velocity of the body (dimensionless)
+	std::vector<double> displacement;	///< Displacement of the body since it was built
+	std::vector<double> labelledDisp;	///< Displacement at which the body was last relabelled
+	std::vector<double> refPositions;	///< Flattened positions of the markers of the closed body as built (MOVABLE only)
+	std::vector<int> labelledSites;		///< Sites labelled as BFL by this body (MOVABLE only)
+	TriMesh mesh;						///< Surface mesh as built (empty unless read from a mesh file)
+
 
 	/************** Member Methods **************/
 private :
 
 	// Initialiser (wrapper for labeller and Q computation)
-	void initialise();
+	void initialise(eMoveableType moveProperty);
+
+	// Label the voxels of the markers and close the surface
+	void labelSites();
+
+	// Compute Q for every voxel of the body
+	void computeSiteQ();
+
+	// Move with the prescribed velocity and relabel if required
+	bool moveBody(std::vector<int> &vacated);
+
+	// Add points which are not on this rank to the body as built
+	void addReferencePoints(PCpts *_PCpts);
 
 	// Compute Q routine + overload
 	void computeQ(int i, int j, int k, GridObj* g);
 	void computeQ(int i, int j, GridObj* g);
 
+	// Compute Q from the surface mesh
+	void computeMeshQ(int i, int j, int k);
+
 	// Surface closure
 	void enforceSurfaceClosure();
 
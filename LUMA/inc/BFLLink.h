@@ -0,0 +1,62 @@
+/*
+* --------------------------------------------------------------
+*
+* ------ Lattice Boltzmann @ The University of Manchester ------
+*
+* -------------------------- L-U-M-A ---------------------------
+*
+* Copyright 2018 The University of Manchester
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.*
+*/
+
+
+#ifndef BFLLINK_H
+#define BFLLINK_H
+
+#include "stdafx.h"
+
+/// \brief	Container class to hold a BFL link.
+///
+///			A BFL link is a streaming link on a grid which is cut by the 
+///			surface of a BFL body.
+class BFLLink {
+
+public:
+
+	/// \brief Constructor.
+	/// \param siteID		flattened ijk index of the site the link streams into
+	/// \param v			lattice direction of the link
+	/// \param q			normalised distance along the link to the wall
+	/// \param bodyID		index of body in the BFL body array
+	/// \param markerID		marker on which the momentum exchange is accumulated
+	/// \param bWallNearSite	true if the wall is nearer the site than the source site
+	/// \param wallTerm		moving wall correction per unit density (zero for static bodies)
+	BFLLink(int siteID, int v, double q, int bodyID, int markerID, bool bWallNearSite, double wallTerm = 0.0)
+		: siteID(siteID), v(v), q(q), bodyID(bodyID), markerID(markerID), bWallNearSite(bWallNearSite), wallTerm(wallTerm)
+	{ };
+
+	/// Default destructor
+	~BFLLink(void) {};
+
+	int siteID;			///< Flattened ijk index of the site the link streams into
+	int v;				///< Lattice direction of the link
+	double q;			///< Normalised distance along the link to the wall
+	int bodyID;			///< Index of body in the BFL body array
+	int markerID;		///< Marker on which the momentum exchange is accumulated
+	bool bWallNearSite;	///< True if the wall is nearer the site than the source site
+	double wallTerm;	///< Moving wall correction per unit density (zero for static bodies)
+
+};
+
+#endif
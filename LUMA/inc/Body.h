@@ -49,16 +49,16 @@ public:
 	Body(GridObj* g, int bodyID, PCpts* _PCpts);
 
 	// Custom constructor for building prefab circle or sphere
-	Body(GridObj* g, int bodyID, std::vector<double> &centre_point, double radius);
+	Body(GridObj* g, int bodyID, std::vector<double> &centre_point, double radius, bool keepAllMarkers = false);
 
 	// Custom constructor for building prefab square or cuboid
-	Body(GridObj* g, int bodyID, std::vector<double> &centre_point, std::vector<double> &dimensions, std::vector<double> &angles);
+	Body(GridObj* g, int bodyID, std::vector<double> &centre_point, std::vector<double> &dimensions, std::vector<double> &angles, bool keepAllMarkers = false);
 
 	// Custom constructor for building prefab square or cuboid
-	Body(GridObj* g, int bodyID, std::vector<double> &centre_point, double length, double width, std::vector<double> &angles);
+	Body(GridObj* g, int bodyID, std::vector<double> &centre_point, double length, double width, std::vector<double> &angles, bool keepAllMarkers = false);
 
 	// Custom constructor for building prefab filament
-	Body(GridObj* g, int bodyID, std::vector<double> &start_position, double length, std::vector<double> &angles);
+	Body(GridObj* g, int bodyID, std::vector<double> &start_position, double length, std::vector<double> &angles, double cost = 0.0, bool keepAllMarkers = false);
 
 	// ************************ Members ************************ //
 
@@ -72,6 +72,13 @@ protected:
 
 	std::vector<int> validMarkers;		///< Vector of indices to valid markers within this body which actually exist on this rank
 
+	/// \brief	Index of the marker in each local voxel.
+	///
+	///			Keyed by flattened local site index of the primary support 
+	///			voxel so the marker in a voxel can be found without searching.
+	///			Must be rebuilt whenever the markers of the body move.
+	std::unordered_map<int, int> siteMarker;
+
 
 	// ************************ Methods ************************ //
 
@@ -81,11 +88,13 @@ protected:
 		int& curr_mark, std::vector<int>& counter);							// Voxelising marker adder
 	void deleteRecvLayerMarkers();											// Delete any markers which are on receiver layer
 	void deleteOffRankMarkers();											// Delete any markers which don't exist on this rank
+	void indexMarkerSite(int m);											// Add a marker to the voxel to marker lookup
+	int getMarkerAtSite(int siteID);										// Get the marker in a local voxel
 
 private:
 	bool isInVoxel(double x, double y, double z, int curr_mark);			// Check a point is inside an existing marker voxel
-	bool isVoxelMarkerVoxel(double x, double y, double z);					// Check whether nearest voxel is a marker voxel
-	int assignOwningRank(int id);											// Assign owning rank based on which ranks own which grids
+	int getMarkerAtPoint(double x, double y, double z);					// Get the marker whose voxel contains a point
+	int assignOwningRank(int id, double cost = 0.0);						// Assign owning rank based on which ranks own which grids
 
 
 protected:
@@ -140,8 +149,10 @@ Body<MarkerType>::Body(GridObj* g, int bodyID, PCpts* _PCpts)
 /// \param 	start_position	start position of base of filament
 /// \param 	length			length of filament
 /// \param 	angles			angle of filament
+/// \param 	cost			structural cost used to choose the owning rank
+/// \param 	keepAllMarkers	keep markers which are off this rank (for bodies which move across ranks)
 template <typename MarkerType>
-Body<MarkerType>::Body(GridObj* g, int bodyID, std::vector<double> &start_position, double length, std::vector<double> &angles)
+Body<MarkerType>::Body(GridObj* g, int bodyID, std::vector<double> &start_position, double length, std::vector<double> &angles, double cost, bool keepAllMarkers)
 {
 
 	// Set the body base class parameters from constructor inputs
@@ -153,7 +164,7 @@ Body<MarkerType>::Body(GridObj* g, int bodyID, std::vector<double> &start_positi
 	this->level = _Owner->level;
 
 	// Set the rank which owns this body
-	this->owningRank = assignOwningRank(id);
+	this->owningRank = assignOwningRank(id, cost);
 
 	// Get horizontal and vertical angles
 	double body_angle_v = angles[0];
@@ -180,7 +191,7 @@ Body<MarkerType>::Body(GridObj* g, int bodyID, std::vector<double> &start_positi
 	int rank = GridUtils::safeGetRank();
 
 	// Delete markers which exist off rank
-	if (rank != owningRank) {
+	if (rank != owningRank && !keepAllMarkers) {
 		*GridUtils::logfile << "Deleting markers which are not on this rank..." << std::endl;
 		deleteOffRankMarkers();
 	}
@@ -194,8 +205,9 @@ Body<MarkerType>::Body(GridObj* g, int bodyID, std::vector<double> &start_positi
 /// \param 	bodyID			ID of body in array of bodies
 /// \param 	centre			centre point of circle
 /// \param 	radius			radius of circle
+/// \param 	keepAllMarkers	keep markers which are off this rank (for bodies which move across ranks)
 template <typename MarkerType>
-Body<MarkerType>::Body(GridObj* g, int bodyID, std::vector<double> &centre, double radius)
+Body<MarkerType>::Body(GridObj* g, int bodyID, std::vector<double> &centre, double radius, bool keepAllMarkers)
 {
 
 	// Set the body base class parameters from constructor inputs
@@ -247,7 +259,7 @@ Body<MarkerType>::Body(GridObj* g, int bodyID, std::vector<double> &centre, doub
 	int rank = GridUtils::safeGetRank();
 
 	// Delete markers which exist off rank
-	if (rank != owningRank) {
+	if (rank != owningRank && !keepAllMarkers) {
 		*GridUtils::logfile << "Deleting markers which are not on this rank..." << std::endl;
 		deleteOffRankMarkers();
 	}
@@ -262,9 +274,10 @@ Body<MarkerType>::Body(GridObj* g, int bodyID, std::vector<double> &centre, doub
 /// \param 	centre				centre point of square
 /// \param 	width_length_depth	dimensions of square
 /// \param 	angles				angle of square
+/// \param 	keepAllMarkers		keep markers which are off this rank (for bodies which move across ranks)
 template <typename MarkerType>
 Body<MarkerType>::Body(GridObj* g, int bodyID, std::vector<double> &centre,	
-	std::vector<double> &width_length_depth, std::vector<double> &angles)
+	std::vector<double> &width_length_depth, std::vector<double> &angles, bool keepAllMarkers)
 {
 
 	// Set the body base class parameters from constructor inputs
@@ -387,7 +400,7 @@ Body<MarkerType>::Body(GridObj* g, int bodyID, std::vector<double> &centre,
 	int rank = GridUtils::safeGetRank();
 
 	// Delete markers which exist off rank
-	if (rank != owningRank) {
+	if (rank != owningRank && !keepAllMarkers) {
 		*GridUtils::logfile << "Deleting markers which are not on this rank..." << std::endl;
 		deleteOffRankMarkers();
 	}
@@ -404,9 +417,10 @@ Body<MarkerType>::Body(GridObj* g, int bodyID, std::vector<double> &centre,
 /// \param length		length of plate
 /// \param width		width of plate
 /// \param angles		angle of plate
+/// \param keepAllMarkers	keep markers which are off this rank (for bodies which move across ranks)
 template <typename MarkerType>
 Body<MarkerType>::Body(GridObj* g, int bodyID, std::vector<double> &centre,
-	double length, double width, std::vector<double> &angles) {
+	double length, double width, std::vector<double> &angles, bool keepAllMarkers) {
 
 	// Set the body base class parameters from constructor inputs
 	this->_Owner = g;
@@ -488,7 +502,7 @@ Body<MarkerType>::Body(GridObj* g, int bodyID, std::vector<double> &centre,
 	int rank = GridUtils::safeGetRank();
 
 	// Delete markers which exist off rank
-	if (rank != owningRank) {
+	if (rank != owningRank && !keepAllMarkers) {
 		*GridUtils::logfile << "Deleting markers which are not on this rank..." << std::endl;
 		deleteOffRankMarkers();
 	}
@@ -544,26 +558,57 @@ template <typename MarkerType>
 void Body<MarkerType>::deleteOffRankMarkers()
 {
 
-	// Loop through markers in body and delete ones which are not on this rank
+	// Filter: erase is O(n^2) so keep markers which are on this rank in a copy instead
 	eLocationOnRank loc = eNone;
-	int a = 0;
-	do {
-		// If not on rank then delete that marker
-		if (!GridUtils::isOnThisRank(
-			this->markers[a].position[eXDirection],
-			this->markers[a].position[eYDirection],
-			this->markers[a].position[eZDirection],
+	std::vector<MarkerType> onRankMarkers;
+	onRankMarkers.reserve(this->markers.size());
+	for (MarkerType& marker : this->markers)
+	{
+		if (GridUtils::isOnThisRank(
+			marker.position[eXDirection],
+			marker.position[eYDirection],
+			marker.position[eZDirection],
 			&loc, this->_Owner))
 		{
-			this->markers.erase(this->markers.begin() + a);
+			onRankMarkers.push_back(std::move(marker));
 		}
-		// If it is, keep and move onto next one
-		else {
+	}
+	this->markers.swap(onRankMarkers);
+};
 
-			// Increment counter
-			a++;
-		}
-	} while (a < static_cast<int>(this->markers.size()));
+/*********************************************/
+/// \brief	Add a marker to the voxel to marker lookup.
+///
+///			Only voxels which lie on this rank are indexed and the first marker
+///			in a voxel is kept, matching a search of the markers in order.
+///
+/// \param	m	index of marker
+template <typename MarkerType>
+void Body<MarkerType>::indexMarkerSite(int m)
+{
+	int i = markers[m].supp_i[0];
+	int j = markers[m].supp_j[0];
+	int k = markers[m].supp_k[0];
+
+	// Check voxel is on this rank
+	eLocationOnRank *loc = nullptr;
+	if (GridUtils::isOffGrid(i, j, k, _Owner) ||
+		!GridUtils::isOnThisRank(_Owner->XPos[i], _Owner->YPos[j], _Owner->ZPos[k], loc, _Owner))
+		return;
+
+	siteMarker.emplace(k + j * _Owner->K_lim + i * _Owner->K_lim * _Owner->M_lim, m);
+}
+
+/*********************************************/
+/// \brief	Get the marker in a local voxel.
+///
+/// \param	siteID	flattened local index of voxel
+/// \returns		index of marker or -1 if there is no marker in the voxel
+template <typename MarkerType>
+int Body<MarkerType>::getMarkerAtSite(int siteID)
+{
+	auto it = siteMarker.find(siteID);
+	return (it == siteMarker.end()) ? -1 : it->second;
 };
 
 /*********************************************/
@@ -631,53 +676,38 @@ MarkerData* Body<MarkerType>::getMarkerData(double x, double y, double z) {
 template <typename MarkerType>
 void Body<MarkerType>::passToVoxelFilter(double x, double y, double z, int markerID, int& curr_mark, std::vector<int>& counter) {
 
-	// If point in current voxel
-	if (isInVoxel(x, y, z, curr_mark)) {
+	// If point not in current voxel then look for an existing marker voxel
+	if (!isInVoxel(x, y, z, curr_mark)) {
 
-		// Increment point counter
-		counter[curr_mark]++;
+		// Recover voxel number
+		int existing_mark = getMarkerAtPoint(x, y, z);
 
-		// Update position of marker in current voxel
-		markers[curr_mark].position[0] =
-			((markers[curr_mark].position[0] * (counter[curr_mark] - 1)) + x) / counter[curr_mark];
-		markers[curr_mark].position[1] =
-			((markers[curr_mark].position[1] * (counter[curr_mark] - 1)) + y) / counter[curr_mark];
-		markers[curr_mark].position[2] =
-			((markers[curr_mark].position[2] * (counter[curr_mark] - 1)) + z) / counter[curr_mark];
+		// Must be in a new marker voxel
+		if (existing_mark < 0) {
 
+			// Reset counter and increment voxel index
+			curr_mark = static_cast<int>(counter.size());
+			counter.push_back(1);
 
-		// If point is in an existing voxel
-	}
-	else if (isVoxelMarkerVoxel(x, y, z)) {
+			// Create new marker as this is a new marker voxel
+			addMarker(x, y, z, markerID);
+			indexMarkerSite(static_cast<int>(markers.size()) - 1);
+			return;
+		}
 
-		// Recover voxel number
-		MarkerData* m_data = getMarkerData(x, y, z);
-		curr_mark = m_data->ID;
-
-		// Increment point counter
-		counter[curr_mark]++;
-
-		// Update position of marker in current voxel
-		markers[curr_mark].position[0] =
-			((markers[curr_mark].position[0] * (counter[curr_mark] - 1)) + x) / counter[curr_mark];
-		markers[curr_mark].position[1] =
-			((markers[curr_mark].position[1] * (counter[curr_mark] - 1)) + y) / counter[curr_mark];
-		markers[curr_mark].position[2] =
-			((markers[curr_mark].position[2] * (counter[curr_mark] - 1)) + z) / counter[curr_mark];
-
-		delete m_data;
-			
+		curr_mark = existing_mark;
 	}
-	// Must be in a new marker voxel
-	else {
 
-		// Reset counter and increment voxel index
-		curr_mark = static_cast<int>(counter.size());
-		counter.push_back(1);
+	// Increment point counter
+	counter[curr_mark]++;
 
-		// Create new marker as this is a new marker voxel
-		addMarker(x, y, z, markerID);
-	}
+	// Update position of marker in current voxel
+	markers[curr_mark].position[0] =
+		((markers[curr_mark].position[0] * (counter[curr_mark] - 1)) + x) / counter[curr_mark];
+	markers[curr_mark].position[1] =
+		((markers[curr_mark].position[1] * (counter[curr_mark] - 1)) + y) / counter[curr_mark];
+	markers[curr_mark].position[2] =
+		((markers[curr_mark].position[2] * (counter[curr_mark] - 1)) + z) / counter[curr_mark];
 
 };
 
@@ -722,30 +752,23 @@ bool Body<MarkerType>::isInVoxel(double x, double y, double z, int curr_mark) {
 };
 
 /*********************************************/
-/// \brief	Determines whether a point is inside an existing marker's support voxel
+/// \brief	Gets the marker whose support voxel contains a point
 ///
 ///			Typically called indirectly by the voxel-grid filter method and not directly.
 ///
 /// \param	x				X-position of point
 /// \param	y				Y-position of point
 /// \param	z				Z-position of point
-/// \returns				true or false
+/// \returns				index of marker or -1 if point is not in a marker voxel
 template <typename MarkerType>
-bool Body<MarkerType>::isVoxelMarkerVoxel(double x, double y, double z) {
+int Body<MarkerType>::getMarkerAtPoint(double x, double y, double z) {
 
-	// Try get the MarkerData store
-	MarkerData* m_data = getMarkerData(x, y, z);
-
-	// True if the data store is not empty
-	if (m_data->isValid()) {
-
-		delete m_data;	// Deallocate the store before leaving scope
-		return true;
-
-	}
+	// Get indices of voxel associated with the supplied position
+	std::vector<int> vox;
+	eLocationOnRank *loc = nullptr;
+	if (!GridUtils::isOnThisRank(x, y, z, loc, _Owner, &vox)) return -1;
 
-	delete m_data;
-	return false;
+	return getMarkerAtSite(vox[2] + vox[1] * _Owner->K_lim + vox[0] * _Owner->K_lim * _Owner->M_lim);
 
 };
 
@@ -767,7 +790,10 @@ void Body<MarkerType>::buildFromCloud(PCpts *_PCpts)
 
 	// Place first marker
 	if (!_PCpts->x.empty())
+	{
 		addMarker(_PCpts->x[0], _PCpts->y[0], _PCpts->z[0], _PCpts->id[0]);
+		indexMarkerSite(0);
+	}
 
 	// Increment counters
 	int curr_marker = 0;
@@ -840,10 +866,16 @@ void Body<MarkerType>::writeVtkPosition(int tval)
 /*********************************************/
 /// \brief	Assigns owning rank of body based on which grids each rank has access to
 ///
-/// \param	id	global body ID
+///			Bodies with no structural cost are dealt out in turn. Bodies which
+///			need a structural solve are given to the rank with the least 
+///			structural work on this level so far. Every rank with the level 
+///			builds the bodies in the same order so they all reach the same answer.
+///
+/// \param	id		global body ID
+/// \param	cost	structural cost of the body
 /// \returns	rank number
 template <typename MarkerType>
-int Body<MarkerType>::assignOwningRank(int id) {
+int Body<MarkerType>::assignOwningRank(int id, double cost) {
 
 	// If serial just return 0
 #ifndef L_BUILD_FOR_MPI
@@ -868,6 +900,21 @@ int Body<MarkerType>::assignOwningRank(int id) {
 			validRanks.push_back(rank);
 	}
 
+	// Bodies with a structural cost go to the valid rank with the least cost so far
+	if (cost > 0.0) {
+		if (mpim->bodyOwnerCost.empty())
+			mpim->bodyOwnerCost.resize(L_NUM_LEVELS + 1, std::vector<double>(mpim->num_ranks, 0.0));
+		std::vector<double> &levelCost = mpim->bodyOwnerCost[level];
+
+		int bestRank = validRanks[0];
+		for (auto rank : validRanks) {
+			if (levelCost[rank] < levelCost[bestRank])
+				bestRank = rank;
+		}
+		levelCost[bestRank] += cost;
+		return bestRank;
+	}
+
 	// Return
 	return validRanks[id % validRanks.size()];
 #endif
@@ -169,6 +169,27 @@ enum eMoveableType {
 	eRigid	///< Immersed boundary body
 };
 
+/// \enum  eFSICoupling
+/// \brief Relaxation of the marker velocities between FSI sub-iterations.
+enum eFSICoupling {
+	eFSIConstant,	///< Constant under-relaxation by L_RELAX
+	eFSIAitken,		///< Dynamic Aitken relaxation starting from L_RELAX
+	eFSIIQNILS		///< Interface quasi-Newton with inverse Jacobian from a least-squares model
+};
+
+/// \enum  eIBCommTag
+/// \brief Message tags of the IBM-MPI exchanges (kept below the halo tags).
+enum eIBCommTag {
+	eIBTagSpread = 1,		///< Spread forces to off-rank support sites
+	eIBTagInterpolate,		///< Interpolate velocities from off-rank support sites
+	eIBTagEpsilonGather,	///< Gather support data on the body owner
+	eIBTagEpsilonScatter,	///< Scatter epsilon from the body owner
+	eIBTagDsScatter,		///< Scatter ds from the body owner
+	eIBTagEpsilonReturn,	///< Return epsilon to the body owner
+	eIBTagUniEpsilonGhosts,	///< Exchange ghost markers for universal epsilon
+	eIBTagUniEpsilonHalo	///< Refresh ghost values during universal epsilon solve
+};
+
 ///	\enum eSDReturnType
 ///	\brief	Return types for smart decomposition methods.
 enum eSDReturnType {
@@ -79,6 +79,7 @@ class FEMBody {
 	int DOFsPerElement;				///< DOFs per element
 	int systemDOFs;					///< DOFs for whole system
 	int BC_DOFs;					///< Number of DOFs removed when applying BCs
+	int bandwidth;					///< Number of sub- (and super-) diagonals of the system matrices
 	int it;							///< Number of iterations for Newton-Raphson solver
 	double res;						///< Residual Newton-Raphson solver reached
 	double timeav_FEMIterations;	///< Number of iterations for Newton-Raphson solver (time-averaged)
@@ -88,9 +89,12 @@ class FEMBody {
 	std::vector<FEMNode> nodes;				///< Vector of FEM nodes
 	std::vector<FEMElement> elements;		///< Vector of FEM elements
 
-	// System matrices
-	std::vector<std::vector<double>> M;			///< Mass matrix
-	std::vector<std::vector<double>> K;			///< Linear stiffness matrix
+	// System matrices (band storage, see GridUtils::solveBandedLinearSystem)
+	std::vector<double> M;						///< Mass matrix
+	std::vector<double> K;						///< Linear stiffness matrix
+	std::vector<double> Kfact;					///< LU factors of the effective stiffness matrix
+	std::vector<int> Kpiv;						///< Pivot indices of the effective stiffness factors
+	bool rebuildK;								///< Rebuild and refactorise the effective stiffness at the next iteration
 	std::vector<double> R;						///< Load vector
 	std::vector<double> F;						///< Vector of internal forces
 	std::vector<double> U;						///< Vector of displacements
@@ -104,16 +108,26 @@ class FEMBody {
 	// Vector of parent elements for each IBM node
 	std::vector<IBMParentElements> IBNodeParents;
 
+	// FSI coupling
+	int subIt;									///< Sub-iteration number within the current time step
+	double relax;								///< Relaxation factor used at the last sub-iteration
+	std::vector<double> fsiResidual_km1;		///< Marker velocity residual at the previous sub-iteration
+	std::vector<double> fsiOutput_km1;			///< FEM marker velocities at the previous sub-iteration
+	std::vector<std::vector<double>> iqnV;		///< IQN-ILS residual differences (most recent first)
+	std::vector<std::vector<double>> iqnW;		///< IQN-ILS FEM marker velocity differences (most recent first)
+
 
 	/************** Member Methods **************/
 
 	// Main FEM solver methods
 	void dynamicFEM();											// Main outer routine for solving FEM
 	void newtonRaphsonIterator();								// Newton-Raphson routine for solve non-linear FEM
-	void setNewmark();											// First step in Newmar-Beta time integration
+	void setNewmark(bool withStiffness);						// First step in Newmar-Beta time integration
 	void finishNewmark();										// Newmark-Beta scheme for getting FEM velocities and accelerations
 	void updateFEMValues();										// Update the FEM node data using the new displacements
 	void updateIBMarkers();										// Update the IBM markers using new FEM node vales
+	void relaxMarkerVelocities(std::vector<double> &femVel);	// Set new marker velocities from the FEM ones
+	void resetCoupling();										// Start the FSI coupling of a new time step
 
 	// Helper methods
 	double checkNRConvergence();								// Check convergence of the Newton-Raphson scheme
@@ -93,10 +93,13 @@ private:
 	double density;									///< Material density
 
 	// Transformation matrix
-	std::vector<std::vector<double>> T;				///< Local transformation matrix
+	double T[L_FEM_EL_DOFS][L_FEM_EL_DOFS];			///< Local transformation matrix
+
+	// Mass matrix (constant in local coordinates)
+	double Mlocal[L_FEM_EL_DOFS][L_FEM_EL_DOFS];	///< Local mass matrix
 
 	// Internal forces
-	std::vector<double> F;							///< Vector of internal forces
+	double F[L_FEM_EL_DOFS];						///< Vector of internal forces
 
 	// Global DOFs
 	std::vector<int> DOFs;							///< Global DOFs for this element
@@ -113,10 +116,15 @@ private:
 	void massMatrix();																// Construct elemental mass matrix
 	void stiffMatrix();																// Construct elemental stiffness matrix
 	void forceVector();																// Construct elemental internal force vector
+	void inertiaVector(const std::vector<double> &acc, std::vector<double> &globalVec);	// Add M.acc without assembling M
+
+	// Transformation to global coordinates
+	void localToGlobal(const double (&localVec)[L_FEM_EL_DOFS], double (&globalVec)[L_FEM_EL_DOFS]);								// Compute T^T.v
+	void localToGlobal(const double (&localMat)[L_FEM_EL_DOFS][L_FEM_EL_DOFS], double (&globalMat)[L_FEM_EL_DOFS][L_FEM_EL_DOFS]);	// Compute T^T.A.T
 
 	// Assembly methods
-	void assembleGlobalMat(const std::vector<double> &localVec, std::vector<double> &globalVec);							// Assemble into global vector
-	void assembleGlobalMat(const std::vector<std::vector<double>> &localMat, std::vector<std::vector<double>> &globalMat);	// Assemble into global matrix
+	void assembleGlobalMat(const double (&localVec)[L_FEM_EL_DOFS], std::vector<double> &globalVec);							// Assemble into global vector
+	void assembleGlobalMat(const double (&localMat)[L_FEM_EL_DOFS][L_FEM_EL_DOFS], std::vector<double> &globalMat);			// Assemble into global banded matrix
 	std::vector<double> disassembleGlobalMat(const std::vector<double> &globalVec);											// Disassemble global vector
 
 };
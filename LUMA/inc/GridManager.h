@@ -92,6 +92,20 @@ protected:
 	/// Vector of structures containing writable region descriptors for block writing (HDF5)
 	std::vector<HDFstruct> p_data;
 
+	/// \brief	Estimated load of a body in the geometry file.
+	///
+	///			Used by the decomposition cost model before any bodies are built.
+	///			The cost is assumed to be spread evenly over the bounding box.
+	///
+	struct BodyLoad
+	{
+		double bounds[6];	///< Bounding box of the body (accessed using eCartMinMax)
+		double cost;		///< Cost per coarse time step in fluid site updates
+	};
+
+	/// Estimated loads of the bodies in the geometry file
+	std::vector<BodyLoad> bodyLoads;
+
 	// METHODS //
 
 public:
@@ -114,6 +128,10 @@ private:
 	long getActiveCellCount(double *bounds, bool bCountAsOps);
 	long getCellCount(int targetLevel, int targetRegion, double *bounds);
 
+	// Decomposition cost model
+	void estimateBodyLoads();
+	double getBlockCost(double *bounds);
+
 
 private:
 	GridManager(void);		///< Private constructor
@@ -25,6 +25,8 @@
 
 #include "stdafx.h"
 #include "IVector.h"
+#include "BFLLink.h"
+class BFLBody;
 
 /// \brief	Grid class.
 ///
@@ -94,6 +96,10 @@ private :
 	IVector<double> ui_timeav;		///< Time-averaged velocity at each grid point (i,j,k,L_DIMS)
 	IVector<double> uiuj_timeav;	///< Time-averaged velocity products at each grid point (i,j,k,3*L_DIMS-3)
 
+	// BFL links
+	std::vector<BFLLink> bflLinks;	///< Streaming links cut by BFL bodies ordered by site
+	std::vector<int> bflLinkStart;	///< Index of the first BFL link of each site (empty if no BFL bodies on grid)
+
 	// Grid scale parameter
 	double refinement_ratio;	///< Equivalent to (1 / pow(2, level))
 
@@ -117,6 +123,7 @@ public :
 	// Timing variables
 	double timeav_mpi_overhead;		///< Time-averaged time of MPI communication
 	double timeav_timestep;			///< Time-averaged time of a timestep
+	double timeav_ibm;				///< Time-averaged time of the IBM steps in a timestep
 
 	// Local grid sizes
 	int N_lim;			///< Local size of grid in X-direction
@@ -140,6 +147,7 @@ public :
 	void LBM_initPositionVector(double start_pos, double end_pos, eCartesianDirection dir);	// Initialise position vector
 	void LBM_initBoundLab();					// Initialise labels for walls
 	void LBM_initRefinedLab(GridObj& pGrid);	// Initialise labels for refined regions
+	void LBM_initBFLLinks();					// Build the list of links cut by BFL bodies
 	eType LBM_setBCPrecedence(eType currentBC, eType desiredBC);		// Determine BC based on any existing BC
 
 	// LBM operations
@@ -149,6 +157,7 @@ public :
 
 	// Multi-grid operations
 	void LBM_addSubGrid(int RegionNumber);				// Add and initialise subgrid structure for a given region number
+	bool LBM_reinitialiseGrid();						// Re-initialise this grid and its sub-grids in place after a redecomposition
 
 	// IO methods
 	void io_textout(std::string output_tag);	// Writes out the contents of the class as well as any subgrids to a text file
@@ -174,11 +183,17 @@ private :
 	void _LBM_macro_opt(int i, int j, int k, int id, eType type_local);
 	void _LBM_forceGrid_opt(int id);
 	double _LBM_equilibrium_opt(int id, int v);
-	bool _LBM_applyBFL_opt(int id, int src_id, int v, int i, int j, int k, int src_x, int src_y, int src_z);
+	void _LBM_applyBFL_opt(int i, int j, int k, int id);
+	double _LBM_bflWallVelocity(const BFLBody &body, int v);
 	bool _LBM_applySpecReflect_opt(int i, int j, int k, int id, int v);
 	void _LBM_regularised_opt(int i, int j, int k, int id, eType type, int subcycle);
 	void _LBM_kbcCollide_opt(int id);
 	void _LBM_resetForces();
+	void _LBM_resetForces(const std::vector<int> &sites);
+	bool _LBM_streamMacroSite_opt(int i, int j, int k, int subcycle);
+	void _LBM_forceCollideSite_opt(int i, int j, int k);
+	void _LBM_finalSite_opt(int i, int j, int k, int subcycle);
+	bool _LBM_isHaloBandSite(int i, int j, int k, int halo);
 	double _LBM_smag(int id, double omega);
 	void _LBM_updateInteriorLatticeSite(int i, int j, int k, int subcycle);
 	double _LBM_updateAndExtrapolate(int subcycle, IVector<double> &quantity,
@@ -29,6 +29,8 @@
 // LAPACK interfaces
 extern "C" void dgetrf_(int* dim1, int* dim2, double* a, int* lda, int* ipiv, int* info);
 extern "C" void dgetrs_(char *TRANS, int *N, int *NRHS, double *A, int *LDA, int *IPIV, double *B, int *LDB, int *INFO );
+extern "C" void dgbtrf_(int *M, int *N, int *KL, int *KU, double *AB, int *LDAB, int *IPIV, int *INFO);
+extern "C" void dgbtrs_(char *TRANS, int *N, int *KL, int *KU, int *NRHS, double *AB, int *LDAB, int *IPIV, double *B, int *LDB, int *INFO);
 
 /// \brief	Grid utility class.
 ///
@@ -77,6 +79,17 @@ public:
 	static std::vector<double> divide(std::vector<double> vec1, double scalar);					// Divide vector by a scalar
 	static std::vector<std::vector<double>> matrix_transpose(std::vector<std::vector<double>> &origMat);			// Transpose a matrix
 	static std::vector<double> solveLinearSystem(std::vector<std::vector<double>> &A, std::vector<double> b, int BC = 0);		// Solve A.x = b
+	static std::vector<double> solveBandedLinearSystem(const std::vector<double> &A, int kl, int ku, std::vector<double> b, int BC = 0);	// Solve banded A.x = b
+	static void factoriseBandedSystem(const std::vector<double> &A, int kl, int ku,
+		std::vector<double> &ab, std::vector<int> &ipiv, int BC = 0);									// LU factorise banded A
+	static std::vector<double> solveFactorisedBandedSystem(std::vector<double> &ab, std::vector<int> &ipiv,
+		int kl, int ku, std::vector<double> b, int BC = 0);												// Solve A.x = b with factorised banded A
+	static std::vector<double> bandMatrix_multiply(const std::vector<double> &A, int kl, int ku, const std::vector<double> &x);		// Banded matrix-vector product
+	static int solveSparseLinearSystem(const std::vector<int> &rowPtr, const std::vector<int> &colIdx,
+		const std::vector<double> &val, const std::vector<double> &b, std::vector<double> &x,
+		double tol, int maxIter, const std::function<void(std::vector<double>&)> &updateGhosts = nullptr,
+		const std::function<void(double*, int)> &sumAcrossRanks = nullptr);								// Solve sparse A.x = b iteratively
+	static std::vector<double> solveLeastSquares(const std::vector<std::vector<double>> &cols, const std::vector<double> &b);	// Minimise |A.x - b| for A given by columns
 
 	// LBM-specific utilities
 	static int getOpposite(int direction);	// Function: getOpposite
@@ -103,7 +116,6 @@ public:
 	static bool isOnRecvLayer(double pos_x, double pos_y, double pos_z);			// Is site on any recv layer
 	static bool isOnSenderLayer(double site_position, eCartMinMax edge);			// Is site on specified sender layer
 	static bool isOnRecvLayer(double site_position, eCartMinMax edge);				// Is site on specified recv layer
-	static int getMpiDirection(int offset_vector[]);								// Get MPI direction from vector
 	static int safeGetRank();														// Parallel/Serial safe method to get rank
 
 	// Coordinate Management
@@ -83,6 +83,26 @@ protected:
 
 	FEMBody *fBody;						///< Pointer to FEM body object
 
+	/// \brief	Geometry of the body relative to the lattice with the ds and epsilon it produced.
+	struct EpsilonCacheEntry {
+		std::vector<double> markerGeometry;		///< Marker positions, dilations and areas relative to the lattice
+		std::vector<double> supportGeometry;	///< Support counts and positions relative to the lattice
+		std::vector<double> ds;					///< Marker spacings computed for this geometry
+		std::vector<double> epsilon;			///< Epsilon computed for this geometry
+	};
+
+	std::vector<int> suppStart;						///< Offset of each valid marker's support sites in the flattened arrays (size of validMarkers + 1)
+	std::vector<int> suppSite;						///< Flattened lattice index of each support site owned by this rank
+	std::vector<double> suppWeight;					///< Delta value of each support site owned by this rank
+	std::vector<int> suppMarker;					///< Index into validMarkers of the marker each support entry belongs to
+	std::vector<int> uniqueSite;					///< Distinct lattice sites in the support owned by this rank
+	std::vector<int> uniqueStart;					///< Offset of each distinct site's entries in uniqueEntry (size of uniqueSite + 1)
+	std::vector<int> uniqueEntry;					///< Support entries grouped by site, in marker order within each site
+
+	std::vector<int> supportCacheIDs;				///< IDs of the valid markers when the support was last found
+	std::vector<double> supportCachePositions;		///< Positions of the valid markers when the support was last found
+	std::vector<EpsilonCacheEntry> epsilonCache;	///< Recently seen geometries (most recent last)
+
 
 	/************** Member Methods **************/
 
@@ -91,6 +111,12 @@ private:
 	void initialise(eMoveableType moveProperty);		// Initialisation wrapper for setting flags
 	void getValidMarkers();								// Get valid markers in iBody (only relevant for owning rank)
 	void sortPtCloudMarkers();							// Sort pt cloud markers and IDs
+	void flattenSupport();								// Pack the on-rank support of the valid markers into contiguous arrays
+	bool isSupportCurrent();							// Check if valid markers are where they were when the support was found
+	void storeSupportCache();							// Record valid marker positions after finding the support
+	std::vector<double> getMarkerGeometry();			// Marker geometry relative to the lattice
+	std::vector<double> getSupportGeometry();			// Support geometry relative to the lattice
+	int findEpsilonCacheEntry(const std::vector<double> &markerGeometry, const std::vector<double> *supportGeometry);
 
 };
 
@@ -123,4 +123,30 @@ public:
 	int markerIdx;					///< Local (rank) index of marker for communicating
 	int supportID;					///< Support index within the marker
 };
+
+
+/// \brief Neighbour list for one side of an IBM comm pattern
+///
+///			Holds the ranks taking part in an IBM communication and the layout
+///			of their comm entries in a single flat buffer. Built alongside the
+///			comm classes so that exchanges only visit the neighbouring ranks.
+class IBCommNeighbourList {
+
+public:
+
+	/************** Constructors **************/
+	IBCommNeighbourList();
+
+	/************** Member Methods **************/
+	void build(const std::vector<int> &entryRank, const std::vector<int> &entrySize);	// Build list from the rank and size of each comm entry
+	void clear();																		// Empty the list
+
+public:
+
+	/************** Member Data **************/
+	std::vector<int> ranks;				///< Neighbouring ranks in ascending order
+	std::vector<int> displs;			///< Start of each neighbour's block in the buffer (size = ranks + 1)
+	std::vector<int> entryDispl;		///< Start of each comm entry in the buffer
+	std::vector<double> buffer;			///< Flat buffer reused between exchanges
+};
 #endif	// L_IBINFO_H
@@ -31,14 +31,6 @@ class GridManager;
 class IBBody;
 
 
-// Define the loop expressions required to inspect the overlap regions of a grid for ease of coding
-#define range_i_left	i = 0; i < GridUtils::downToLimit((int)pow(2, g->level + 1), N_lim); i++	///< For loop definition for left halo
-#define range_j_down	j = 0; j < GridUtils::downToLimit((int)pow(2, g->level + 1), M_lim); j++	///< For loop definition for bottom halo
-#define range_k_front	k = 0; k < GridUtils::downToLimit((int)pow(2, g->level + 1), K_lim); k++	///< For loop definition for front halo
-#define range_i_right	i = GridUtils::upToZero(N_lim - (int)pow(2, g->level + 1)); i < N_lim; i++	///< For loop definition for right halo
-#define range_j_up		j = GridUtils::upToZero(M_lim - (int)pow(2, g->level + 1)); j < M_lim; j++	///< For loop definition for top halo
-#define range_k_back	k = GridUtils::upToZero(K_lim - (int)pow(2, g->level + 1)); k < K_lim; k++	///< For loop definition for back halo
-
 /// \brief	MPI Manager class.
 ///
 ///			Class to manage all MPI apsects of the code.
@@ -102,18 +94,10 @@ public :
 
 	// MPI world data (all public)
 	MPI_Comm world_comm;	///< Global MPI communicator
+	MPI_Comm token_comm;	///< Duplicate of world communicator reserved for rank-ordered access tokens
 
-	/// \brief	Cartesian unit vectors pointing to each neighbour in Cartesian topology.
-	///
-	///			Define 3D such that first 8 mimic the 2D ones. Opposites are 
-	///			simply the next or previous column in the array. MSVC 2013 does
-	///			not support initialiser lists tagged onto the constructor although
-	///			it is valid C++ so I have had to make it static even though it goes
-	///			against the idea of the singleton design.
-	static const int neighbour_vectors[3][26];
-	int dimensions[3];							///< Size of MPI Cartesian topology
-	int neighbour_rank[L_MPI_DIRS];				///< Neighbour rank number for each direction in Cartesian topology
-	int neighbour_coords[L_DIMS][L_MPI_DIRS];	///< Coordinates in MPI topology of neighbour ranks
+	int dimensions[3];		///< Size of MPI Cartesian topology (not used with recursive bisection)
+	bool has_halo[3];		///< Flag indicating whether the block on this rank has a halo in each direction
 
 	// Sizes of each of the MPI domains
 	/// Number of sites in X direction for each custom rank.
@@ -122,6 +106,12 @@ public :
 	std::vector<int> cRankSizeY;
 	/// Number of sites in Z direction for each custom rank.
 	std::vector<int> cRankSizeZ;
+	/// Index of first site in X direction for each custom rank (recursive bisection only).
+	std::vector<int> cRankStartX;
+	/// Index of first site in Y direction for each custom rank (recursive bisection only).
+	std::vector<int> cRankStartY;
+	/// Index of first site in Z direction for each custom rank (recursive bisection only).
+	std::vector<int> cRankStartZ;
 	
 	/// Communicators for sub-grid / region combinations
 #if (L_NUM_LEVELS > 0)
@@ -135,8 +125,8 @@ public :
 
 	// Commonly used properties of the rank / topology
 	int my_rank;				///< Rank number
-	int num_ranks;				///< Total number of ranks in MPI Cartesian topology
-	int rank_coords[L_DIMS];	///< Coordinates in MPI Cartesian topology
+	int num_ranks;				///< Total number of ranks
+	int rank_coords[L_DIMS];	///< Coordinates in MPI Cartesian topology (not used with recursive bisection)
 
 
 	/// \brief	Absolute positions of edges of the core region represented on this rank.
@@ -149,6 +139,9 @@ public :
 	/// Vector of size num_ranks which indicates how many sub-grids each rank has access to
 	std::vector<int> rankGrids;
 
+	/// Structural cost of the bodies given to each rank so far (indexed by level then rank)
+	std::vector< std::vector<double> > bodyOwnerCost;
+
 	/// \struct HaloEdgeStruct
 	/// \brief	Structure containing absolute positions of the edges of halos.
 	///
@@ -166,25 +159,36 @@ public :
 	
 
 	// Buffer data
-	std::vector< std::vector<double>> f_buffer_send;	///< Array of resizeable outgoing buffers used for data transfer
-	std::vector< std::vector<double>> f_buffer_recv;	///< Array of resizeable incoming buffers used for data transfer
+	std::vector< std::vector<double>> f_buffer_send;	///< Outgoing buffer for each neighbour of the grid being communicated
+	std::vector< std::vector<double>> f_buffer_recv;	///< Incoming buffer for each neighbour of the grid being communicated
 	MPI_Status recv_stat;					///< Status structure for Receive return information
-	MPI_Request send_requests[L_MPI_DIRS];	///< Array of request structures for handles to posted ISends
-	MPI_Status send_stat[L_MPI_DIRS];		///< Array of statuses for each ISend
+	std::vector<MPI_Request> send_requests;	///< Request handles for the posted ISends
+	int send_count;							///< Number of ISends posted by the current halo exchange
+	double comm_time;						///< Wall time spent in the current halo exchange
+	double comm_time_accum;					///< Wall time spent in halo exchanges since last reset (used for rebalancing)
+
+	// Measured cost data used by the decomposition when rebalancing
+	std::vector<double> rank_cost_per_op;					///< Measured cost of an operation on each rank (empty unless rebalancing)
+	std::vector< std::vector<double> > rank_cost_edge;		///< Core edges of each rank at the time the costs were measured
 
-	/// \struct BufferSizeStruct
-	/// \brief	Structure storing buffers sizes in each direction for particular grid.
-	struct BufferSizeStruct
+	/// \struct HaloExchangeStruct
+	/// \brief	Structure storing the neighbour list of a particular grid.
+	///
+	///			For each neighbour rank the local indices of the sites sent
+	///			to and received from it are stored in the order in which they 
+	///			are packed so no geometric search is needed during an exchange.
+	struct HaloExchangeStruct
 	{
-		int size[L_MPI_DIRS];	///< Buffer sizes for each direction
-		int level;				///< Grid level
-		int region;				///< Region number
+		int level;										///< Grid level
+		int region;										///< Region number
+		std::vector<int> neighbours;					///< Ranks this grid exchanges with
+		std::vector< std::vector<int> > send_sites;		///< Local indices of sites sent to each neighbour
+		std::vector< std::vector<int> > recv_sites;		///< Local indices of sites received from each neighbour
 
-		BufferSizeStruct(int l, int r) 
+		HaloExchangeStruct(int l, int r) 
 			: level(l), region(r){};
 	};
-	std::vector<BufferSizeStruct> buffer_send_info;	///< Vectors of buffer_info structures holding sender layer size info.
-	std::vector<BufferSizeStruct> buffer_recv_info;	///< Vectors of buffer_info structures holding receiver layer size info.
+	std::vector<HaloExchangeStruct> halo_info;	///< Neighbour lists of each grid on this rank
 
 	/// Logfile handle
 	std::ofstream* logout;
@@ -195,6 +199,17 @@ public :
 	std::vector<std::vector<SupportCommMarkerSideClass>> supportCommMarkerSide;		///< Marker-side marker-support comm
 	std::vector<std::vector<SupportCommSupportSideClass>> supportCommSupportSide;	///< Support-side marker-support comm
 
+	// IBM neighbour lists (built with the comm classes)
+	std::vector<IBCommNeighbourList> markerNbrOwnerSide;		///< Owner-side marker-owner neighbours (one entry per marker)
+	std::vector<IBCommNeighbourList> markerNbrMarkerSide;		///< Marker-side marker-owner neighbours (one entry per marker)
+	std::vector<IBCommNeighbourList> markerSuppNbrOwnerSide;	///< Owner-side marker-owner neighbours (one entry per support site)
+	std::vector<IBCommNeighbourList> markerSuppNbrMarkerSide;	///< Marker-side marker-owner neighbours (one entry per support site)
+	std::vector<IBCommNeighbourList> supportNbrMarkerSide;		///< Marker-side marker-support neighbours
+	std::vector<IBCommNeighbourList> supportNbrSupportSide;		///< Support-side marker-support neighbours
+	IBCommNeighbourList uniEpsNbrSend;							///< Neighbours sent local markers in universal epsilon calculation
+	IBCommNeighbourList uniEpsNbrRecv;							///< Neighbours sending ghost markers in universal epsilon calculation
+	std::vector<int> uniEpsSendIdx;								///< Local marker of each entry sent in universal epsilon calculation
+
 
 
 	/************** Member Methods **************/
@@ -206,54 +221,65 @@ public :
 	// Initialisation
 	void mpi_init();												// Initialisation of MpiManager & Cartesian topology
 	void mpi_gridbuild(GridManager* const grid_man);				// Do domain decomposition to build local grid dimensions
+	void mpi_updateBlockEdges(GridManager* const grid_man);			// Set local size, core edges and halo positions from the rank sizes
 	void mpi_communicateBlockEdges();								// Get the positional limits of all ranks
 	int mpi_buildCommunicators(GridManager* const grid_man);		// Create a new communicator for each sub-grid and region combo
 	void mpi_updateLoadInfo(GridManager* const grid_man);			// Method to compute the number of active cells on the rank and pass to master
 	void mpi_uniformDecompose(int *numCells);						// Method to perform uniform decomposition into MPI blocks
+	double mpi_rcbDecompose();										// Method to perform recursive bisection decomposition into MPI blocks
+	void mpi_rcbBisect(int *lo, int *hi, int firstRank, int numRanks);	// Recursively split a block between a group of ranks
 	LoadImbalanceData mpi_smartDecompose(double dh,
 		std::vector<int> combo = std::vector<int>(0));				// Method to perform load-balanced decomposition into MPI blocks
 	void mpi_reportOnDecomposition(double dh);						// Method to provide a report on decomposition options
 	void mpi_SDReconstructSolution(SDData& solutionData, std::vector<int>& numCores);
 	void mpi_SDComputeImbalance(LoadImbalanceData& load, SDData& solutionData, std::vector<int>& numCores);
+	double mpi_SDComputeBlockCost(double *bounds);
 	bool mpi_SDCheckDelta(SDData& solutionData, double dh, std::vector<int>& numCores);
 	void mpi_SDCommunicateSolution(SDData& solutionData, double imbalance, double dh);
 	void mpi_setSubGridDepth();										// Method to initialise the rankGrids variable
 
+	// Load rebalancing
+	bool mpi_rebalance(GridManager* const grid_man, double work_time);	// Redecompose and migrate the grids if measured load is imbalanced
+	void mpi_rebalancePack(GridManager* const grid_man, std::vector<double>& siteData);		// Pack the core sites of all grids on this rank
+	void mpi_rebalanceMigrate(GridManager* const grid_man, std::vector<double>& siteData);	// Send packed sites to their new ranks and unpack
+
 	// Helper functions
 	std::vector<int> mpi_mapRankLevelToWorld(int level);			// Map rank numbers from level communicator to world communcator
 	std::vector<int> mpi_mapRankWorldToLevel(int level);			// Map rank numbers from world communicator to level communicator
 
 	// Buffer methods
-	void mpi_buffer_pack(int dir, GridObj* const g);		// Pack the buffer ready for data transfer on the supplied grid in specified direction
-	void mpi_buffer_unpack(int dir, GridObj* const g);		// Unpack the buffer back to the grid given
-	void mpi_buffer_size();									// Set buffer size information for grids in hierarchy given and 
-															// set pointer to hierarchy for subsequent access
-	void mpi_buffer_size_send( GridObj* const g );			// Routine to find the size of the sending buffer on supplied grid
-	void mpi_buffer_size_recv( GridObj* const g );			// Routine to find the size of the receiving buffer on supplied grid
+	void mpi_buffer_pack(int n, const HaloExchangeStruct& halo, GridObj* const g, bool packNew = false);	// Pack the buffer for the given neighbour of the supplied grid
+	void mpi_buffer_unpack(int n, const HaloExchangeStruct& halo, GridObj* const g);	// Unpack the buffer from the given neighbour back to the grid
+	void mpi_buffer_size();									// Build the neighbour lists for grids in the hierarchy
 
 	// IO
-	void mpi_writeout_buf(std::string filename, int dir);		// Write out the buffers of direction dir to file
+	void mpi_writeout_buf(std::string filename, int n);		// Write out the buffers of neighbour n to file
 
 	// Comms
 	void mpi_communicate( int level, int regnum );		// Wrapper routine for communication between grids of given level/region
-	int mpi_getOpposite(int direction);					// Version of GridUtils::getOpposite for MPI_directions rather than lattice directions
+	void mpi_communicateBegin(int level, int regnum, bool packNew);	// Pack, send and receive halo without unpacking
+	void mpi_communicateEnd(int level, int regnum);		// Unpack received halo and complete sends
+	void mpi_waitForTurn();								// Block until the previous rank has finished its turn at a shared resource
+	void mpi_passTurn();								// Hand the turn at a shared resource on to the next rank
 
 	// IBM
 	void mpi_buildMarkerComms(int level);												// Build comms required for epsilon calculation
 	void mpi_buildSupportComms(int level);												// Build comms required for support communication
+	void mpi_ibmExchange(IBCommNeighbourList &sendList, IBCommNeighbourList &recvList, int stride, int tag);	// Exchange flat IBM buffers with neighbouring ranks
 	void mpi_epsilonCommGather(int level);												// Do communication required for epsilon calculation
 	void mpi_epsilonCommScatter(int level);												// Do communication required for epsilon calculation
-	void mpi_uniEpsilonCommGather(int level, int rootRank, IBBody &iBodyTmp);			// Do communication required for universal epsilon calculation
-	void mpi_uniEpsilonCommScatter(int level, int rootRank, IBBody &iBodyTmp);			// Do communication required for universal epsilon calculation
-	void mpi_interpolateComm(int level, std::vector<std::vector<double>> &interpVels);	// Do communication required for velocity interpolation
-	void mpi_spreadComm(int level, std::vector<std::vector<double>> &spreadForces);		// Do communication required for force spreading
+	void mpi_epsilonCommReturn(int level);												// Return epsilon from marker ranks to the body owner
+	void mpi_uniEpsilonBuildGhosts(int level, const std::vector<double> &localData, double reach, std::vector<double> &ghostData);	// Exchange nearby markers for universal epsilon calculation
+	void mpi_uniEpsilonUpdateGhosts(std::vector<double> &values, int nLocal);			// Refresh ghost values in universal epsilon solve
+	void mpi_interpolateComm(int level);												// Do communication required for velocity interpolation
+	void mpi_spreadComm(int level);														// Do communication required for force spreading
 	void mpi_dsCommScatter(int level);													// Spread the ds values from owner to other ranks
 	void mpi_ptCloudMarkerGather(IBBody *iBody, std::vector<double> &recvPositionBuffer, std::vector<int> &recvIDBuffer, std::vector<int> &recvSizeBuffer, std::vector<int> &recvDisps);		// Gather in info for pt cloud sorter
-	void mpi_ptCloudMarkerScatter(IBBody *iBody, std::vector<int> &recvIDBuffer, std::vector<int> &recvSizeBuffer, std::vector<int> &recvDisps);	// Scatter info for pt cloud sorter
+	void mpi_ptCloudMarkerSort(IBBody *iBody);											// Renumber pt cloud markers by distributed sample sort
 
 	// FEM
 	void mpi_forceCommGather(int level);
-	void mpi_spreadNewMarkers(int level, std::vector<std::vector<int>> &markerIDs, std::vector<std::vector<std::vector<double>>> &positions, std::vector<std::vector<std::vector<double>>> &vels);
+	void mpi_spreadNewMarkers(int level, const std::vector<int> &idxOwned, std::vector<std::vector<int>> &markerIDs, std::vector<std::vector<std::vector<double>>> &positions, std::vector<std::vector<std::vector<double>>> &vels);
 };
 
 #endif
@@ -113,6 +113,7 @@ private:
 	// Flag for if there are any flexible bodies in the simulation
 	std::vector<bool> hasIBMBodies;
 	std::vector<bool> hasFlexibleBodies;
+	std::vector<bool> hasMovableBFLBodies;
 
 	// Map global body ID to an index in the iBody vector
 	std::vector<int> bodyIDToIdx;
@@ -120,6 +121,15 @@ private:
 	// Vector of indices for iBody vector for which this rank owns and is flexible
 	std::vector<int> idxFEM;
 
+	// Distinct lattice sites on each level whose force or velocity IBM modifies on this rank
+	std::vector< std::vector<int> > ibmSites;
+
+	// Sites modified since the grid was last restored (superset of ibmSites during sub-iteration)
+	std::vector< std::vector<int> > ibmDirtySites;
+
+	// Delta kernel tabulated at fixed resolution (L_IBM_DELTA_TABLE only)
+	std::vector<double> deltaTable;
+
 	// Subiteration loop parameters
 	double timeav_subResidual;
 	double timeav_subIterations;
@@ -142,18 +152,21 @@ public:
 	void ibm_apply(GridObj *g, bool doSubIterate);									// Apply interpolate, compute and spread operations for all bodies.
 	void ibm_initialise();															// Initialise a built immersed body with support.
 	double ibm_deltaKernel(double rad, double dilation);							// Evaluate kernel (delta function approximation).
+	void ibm_deltaKernel(const double *rad, double dilation, int n, double *value);	// Evaluate kernel for an array of distances.
 	void ibm_interpolate(int level);												// Interpolation of velocity field onto markers of ib-th body.
 	void ibm_spread(int level);														// Spreading of restoring force from ib-th body.
-	void ibm_updateMacroscopic(int level);											// Update the macroscopic values with the IBM force
+	void ibm_updateMacroscopic(GridObj *g);											// Update the macroscopic values with the IBM force
 	void ibm_findSupport(int ib);													// Populates support information for the m-th marker of ib-th body.
-	void ibm_initialiseSupport(int ib, int m, std::vector<double> &estimated_position);	// Initialises data associated with the support points.
 	void ibm_computeForce(int level);												// Compute restorative force at each marker in ib-th body.
 	void ibm_findEpsilon(int level);												// Method to find epsilon weighting parameter for ib-th body.
+	void ibm_findEpsilonSparse(IBBody &body);										// Sparse assembly and iterative solve of the epsilon system of a body.
+	void ibm_findEpsilonUniversal(int level);										// Distributed epsilon solve coupling all markers on a level.
+	void ibm_assembleEpsilonSystem(const std::vector<IBMarker*> &rows, const std::vector<double> &colData, double dh,
+		std::vector<int> &rowPtr, std::vector<int> &colIdx, std::vector<double> &val);	// Assemble the epsilon rows of the given markers in CSR format.
 	void ibm_computeDs(int level);
 	void ibm_moveBodies(int level);													// Update all IBBody positions and support.
+	void ibm_buildSiteSet(int level);												// Collect the distinct lattice sites IBM modifies on this rank
 	void ibm_finaliseReadIn(int iBodyID);											// Do some house-keeping after geometry read in
-	void ibm_universalEpsilonGather(int level, IBBody &iBodyTmp);					// Gather all the markers into the temporary iBody vector
-	void ibm_universalEpsilonScatter(int level, IBBody &iBodyTmp);					// Gather all the markers into the temporary iBody vector
 	void ibm_subIterate(GridObj *g);												// Subiterate to enforce correct kinematic conditions at interface
 	double ibm_checkVelDiff(int level);												// Check residual from sub-iteration step
 
@@ -170,13 +183,21 @@ public:
 	void ibm_updateMPIComms(int level);
 	void ibm_interpolateOffRankVels(int level);
 	void ibm_spreadOffRankForces(int level);
-	void ibm_updateMarkers(int level);
+	void ibm_updateMarkers(int level, bool bAllBodies = false);
+
+	// BFL methods //
+	void bfl_moveBodies(GridObj *g);									// Move MOVABLE BFL bodies on a grid and update its BFL links.
+	void bfl_refillSites(GridObj *g, const std::vector<int> &sites,
+		const std::vector<double> &uWall);								// Reinitialise the sites uncovered by a moving BFL body.
 
 	// Bounceback Body Methods
 	void addBouncebackObject(GeomPacked *geom, PCpts *_PCpts);				// Override method to add BBB from cloud reader.
 	void addBouncebackObject(GridObj *g, GeomPacked *geom, PCpts *_PCpts);	// Method to add a BBB from the cloud reader.
+	void addBouncebackObject(GeomPacked *geom, TriMesh &mesh);				// Override method to add BBB from mesh reader.
+	void addBouncebackObject(GridObj *g, GeomPacked *geom, TriMesh &mesh);	// Method to add a BBB from the mesh reader.
+	void voxeliseMesh(GridObj *g, TriMesh &mesh, bool bAllowRefined);		// Label the sites inside a closed mesh as solid.
 	void computeLiftDrag(int i, int j, int k, GridObj *g);			// Compute force using Momentum Exchange for BBB on supplied grid.
-	void computeLiftDrag(int v, int id, GridObj *g, int markerID);	// Compute force using Momentum Exchange for BFL on supplied grid.
+	void computeLiftDrag(int v, int id, GridObj *g, int bodyID, int markerID);	// Compute force using Momentum Exchange for BFL on supplied grid.
 	void resetMomexBodyForces(GridObj * grid);						// Reset the force stores for Momentum Exchange
 
 	// IO methods //
@@ -186,9 +207,20 @@ public:
 	void io_writeLiftDrag();								// Write out IBBody lift and drag at specified timestep
 	void io_restart(eIOFlag IO_flag, int level);			// Restart read and write for IBBodies given grid level
 	void io_readInCloud(PCpts*& _PCpts, GeomPacked *geom);	// Method to read in Point Cloud data
+	bool io_readInBinaryCloud(PCpts*& _PCpts, GeomPacked *geom,
+		GridObj *g, double dCell, double *bbMin, double *bbMax);	// Read the part of a binary point cloud near this rank
+	void io_readInMesh(GeomPacked *geom);					// Method to read in triangle mesh data
+	void io_getRankExtent(GridObj *g, double margin,
+		double *rankMin, double *rankMax);					// Extent of a grid on this rank
+	void io_getCloudTransform(GeomPacked *geom, double dCell,
+		const double *bbMin, const double *bbMax,
+		double &scale_factor, double *shift);				// Scale and shift to place a body from file
+	void io_buildCloudBody(PCpts*& _PCpts, GeomPacked *geom,
+		GridObj *g, double dCell, const TriMesh *mesh = nullptr);	// Filter placed points to this rank and build the body
 	void io_writeForcesOnObjects(double tval);				// Method to write object forces to a csv file
 	void io_readInGeomConfig();								// Read in geometry configuration file
 	void io_writeTipPositions(int t);						// Write out tip positions of flexible filaments
+	void io_writeCostCalibration();							// Write out the measured cost of IBM markers for the decomposition cost model
 
 	// Debug
 	void toggleDebugStream(GridObj *g);		// Method to open/close a debugging file
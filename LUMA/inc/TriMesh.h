@@ -0,0 +1,73 @@
+/*
+* --------------------------------------------------------------
+*
+* ------ Lattice Boltzmann @ The University of Manchester ------
+*
+* -------------------------- L-U-M-A ---------------------------
+*
+* Copyright 2018 The University of Manchester
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.*
+*/
+
+#ifndef TRIMESH_H
+#define TRIMESH_H
+
+#include "stdafx.h"
+class PCpts;
+
+/// \brief	Class to hold triangle mesh data.
+///
+///			Holds the triangles of a surface read from an STL (binary or
+///			ASCII) or OBJ file. Triangles are binned by their extent in the
+///			Y-Z plane so that rays cast in the X-direction and lattice links
+///			only test the triangles near them.
+class TriMesh {
+
+public:
+
+	/// Default constructor
+	TriMesh(void) : binSize(0.0) {};
+
+	/// Default destructor
+	~TriMesh(void) {};
+
+	// Methods
+	static bool isMeshFile(const std::string &fileName);		// Check the file extension is a mesh format
+	bool read(const std::string &fileName);						// Read in an STL or OBJ file
+	bool empty() const { return tri.empty(); }					///< True if there are no triangles
+	size_t size() const { return tri.size() / 9; }				///< Number of triangles
+	void getBoundingBox(double *bbMin, double *bbMax) const;	// Get the bounding box of the vertices
+	void transform(double scale, const double *shift);			// Scale then shift the vertices
+	void cull(const double *bbMin, const double *bbMax);		// Remove triangles outside a box
+	void buildBins(double spacing);							// Bin the triangles in the Y-Z plane
+	void getRayCrossings(double y, double z, std::vector<double> &xCross) const;	// Sorted X-positions where a ray in X crosses the surface
+	double intersectSegment(const double *p0, const double *p1) const;			// Fraction along a segment of the nearest crossing
+	void sampleSurface(double spacing, const double *bbMin, const double *bbMax, PCpts *_PCpts) const;	// Generate points on the surface
+
+private:
+	bool readBinarySTL(std::ifstream &file);
+	bool readAsciiSTL(std::ifstream &file);
+	bool readOBJ(std::ifstream &file);
+	void getBinRange(double yMin, double yMax, double zMin, double zMax, int *range) const;
+
+	// Members
+	std::vector<double> tri;		///< Vertex coordinates of the triangles (9 per triangle)
+	double binSize;					///< Size of the Y-Z bins
+	double binOrigin[2];			///< Lower Y-Z corner of the bins
+	int numBins[2];					///< Number of bins in Y and Z
+	std::vector< std::vector<int> > bins;	///< Indices of the triangles overlapping each bin
+
+};
+
+#endif
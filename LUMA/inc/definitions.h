@@ -83,7 +83,9 @@
 #define L_BUILD_FOR_MPI				///< Enable MPI features in build
 
 // Enable OMP support?
-#define L_ENABLE_OPENMP				///< Enable OpenMP features (experimental)
+#define L_ENABLE_OPENMP				///< Enable OpenMP features (threads per rank set at launch through OMP_NUM_THREADS)
+#define L_MPI_OVERLAP_COMMS			///< Use one thread per rank to drive the halo exchange while the others update the interior
+//#define L_MPI_THREAD_MULTIPLE		///< Request MPI_THREAD_MULTIPLE so any thread may drive communication (default is MPI_THREAD_FUNNELED)
 
 // Output Options
 #define L_GRID_OUT_FREQ 500						///< How many timesteps before whole grid output
@@ -149,10 +151,24 @@
 #define L_MPI_XCORES 4		///< Number of MPI ranks to divide domain into in X direction
 #define L_MPI_YCORES 2		///< Number of MPI ranks to divide domain into in Y direction
 #define L_MPI_ZCORES 1		///< Number of MPI ranks to divide domain into in Z direction.
+//#define L_MPI_AUTO_TOPOLOGY	///< Ignore the values above and build the topology from the number of ranks launched
 
 // Decomposition strategy
 #define L_MPI_SMART_DECOMPOSE		///< Use smart decomposition to improve load balancing
 #define L_MPI_SD_MAX_ITER 1000		///< Max number of iterations to be used for smart decomposition algorithm
+//#define L_MPI_RCB_DECOMPOSE		///< Use recursive bisection for any number of ranks (ignores the core counts above)
+
+// Decomposition cost model (costs relative to a fluid site update -- calibrate with L_LOG_TIMINGS)
+#define L_MPI_SD_COST_FLUID 1.0		///< Cost of a fluid site update
+#define L_MPI_SD_COST_SOLID 0.25	///< Cost of a solid site update
+#define L_MPI_SD_COST_BOUNDARY 1.5	///< Cost of a velocity/pressure (or regularised) boundary site update
+#define L_MPI_SD_COST_BFL 2.0		///< Cost of a BFL boundary site update
+#define L_MPI_SD_COST_IBM 20.0		///< Cost of interpolating and spreading for one IBM marker
+
+// Run-time load rebalancing
+//#define L_MPI_REBALANCE			///< Redecompose the domain at run time based on measured step times
+#define L_MPI_REBALANCE_FREQ 1000	///< Number of L0 time steps between load balance checks
+#define L_MPI_REBALANCE_TOL 10.0	///< Measured imbalance (% of slowest rank) above which the domain is redecomposed
 
 // Topology report
 //#define L_MPI_TOPOLOGY_REPORT		///< Have the MPI Manager report on different combinations of X Y Z cores
@@ -218,11 +234,26 @@
 // IBM //
 //#define L_IBM_ON				///< Turn on IBM
 //#define L_UNIVERSAL_EPSILON_CALC		///< Do universal epsilon calculation (should be used if supports from different bodies overlap)
+#define L_IBM_SPARSE_EPSILON			///< Assemble epsilon system from interacting markers only and solve iteratively (dense LU if undefined)
+#define L_IBM_EPSILON_TOL 1e-10		///< Relative residual tolerance of the iterative epsilon solve
+#define L_IBM_EPSILON_MAX_ITER 500		///< Maximum iterations of the iterative epsilon solve
+#define L_IBM_EPSILON_CACHE 4			///< Number of past body geometries (relative to the lattice) whose ds and epsilon are kept for reuse (comment out to disable)
+#define L_IBM_EPSILON_CACHE_TOL 1e-9	///< Tolerance (in lattice units) for matching a cached geometry
+//#define L_IBM_DELTA_TABLE 1000		///< Tabulate the delta kernel at this many points per lattice unit and interpolate linearly (exact evaluation if undefined)
+
+// BFL //
+#define L_BFL_MOVE_UX 0.0			///< Prescribed x-velocity of MOVABLE BFL bodies (dimensionless)
+#define L_BFL_MOVE_UY 0.0			///< Prescribed y-velocity of MOVABLE BFL bodies (dimensionless)
+#define L_BFL_MOVE_UZ 0.0			///< Prescribed z-velocity of MOVABLE BFL bodies (dimensionless)
+#define L_BFL_MOVE_TOL 0.0			///< Distance (in lattice spacings) a MOVABLE BFL body travels before its sites are relabelled (0 to relabel every step)
 
 // FEM //
 #define L_NB_ALPHA 0.25				///< Parameter for Newmark-Beta time integration (0.25 for 2nd order)
 #define L_NB_DELTA 0.5				///< Parameter for Newmark-Beta time integration (0.5 for 2nd order)
-#define L_RELAX 0.5				///< Under-relaxation for FSI coupling
+#define L_FEM_EL_DOFS 6				///< DOFs per beam element (2 nodes with 3 DOFs each)
+//#define L_FEM_MODIFIED_NEWTON 0.5	///< Reuse the factorised effective stiffness across Newton iterations, refactorising when the residual falls by less than this factor
+#define L_RELAX 0.5				///< Under-relaxation for FSI coupling (first sub-iteration only if accelerated)
+#define L_FSI_COUPLING eFSIAitken	///< Sub-iteration coupling: eFSIConstant, eFSIAitken or eFSIIQNILS
 //#define L_WRITE_TIP_POSITIONS			///< Turn on writing out filament tip positions (only works on flexible filaments)
 
 /*
@@ -323,14 +354,9 @@ const static double cProbeLimsZ[2] = { L_PROBE_MIN_Z, L_PROBE_MAX_Z };	///< Limi
 #define L_NUM_VELS 19		///< Number of lattice velocities
 #endif
 
-#define L_MPI_DIRS 26	///< Number of MPI directions
-
 #else
 #define L_NUM_VELS 9		// Use D2Q9
 
-// MPI config to 2D
-#define L_MPI_DIRS 8
-
 // Set Z limits for 2D
 #undef L_BZ
 #define L_BZ 0
@@ -352,6 +378,10 @@ const static double cProbeLimsZ[2] = { L_PROBE_MIN_Z, L_PROBE_MAX_Z };	///< Limi
 #undef L_UZ0
 #define L_UZ0 0.0
 
+// Set z BFL velocity
+#undef L_BFL_MOVE_UZ
+#define L_BFL_MOVE_UZ 0.0
+
 #endif
 
 #if L_NUM_LEVELS == 0
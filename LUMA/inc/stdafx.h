@@ -71,6 +71,7 @@
 #include <valarray>
 #include <assert.h>
 #include <functional>
+#include <unordered_map>
 
 // Check OS is Windows or not
 #ifdef _WIN32
@@ -201,6 +202,9 @@ inline void debugfcn(const std::string &msg, std::ofstream *logfile)
 
 // Include definitions, singletons and headers to be made available everywhere for convenience.
 #include "definitions.h"
+#ifdef L_ENABLE_OPENMP
+#include <omp.h>
+#endif
 #include "GridManager.h"
 #include <mpi.h>
 #include "MpiManager.h"
@@ -31,6 +31,7 @@
 /******************************************************************************/
 /// Default constructor
 BFLBody::BFLBody(void)
+	: isMovable(false)
 {
 }
 
@@ -46,9 +47,18 @@ BFLBody::~BFLBody(void)
 ///			This initialiser performs debugging IO and wraps the calling of the
 ///			labelling and Q computation. It is called immediately after the 
 ///			appropriate constructor by all derived constructors.
-void BFLBody::initialise()
+///
+/// \param	moveProperty	enumeration indicating whether the body moves.
+void BFLBody::initialise(eMoveableType moveProperty)
 {
 
+	// Set the prescribed motion
+	isMovable = (moveProperty == eMovable);
+	uWall = { L_BFL_MOVE_UX, L_BFL_MOVE_UY, L_BFL_MOVE_UZ };
+	if (!isMovable) uWall.assign(3, 0.0);
+	displacement.resize(3, 0.0);
+	labelledDisp.resize(3, 0.0);
+
 	// Write out marker data now body has been built
 #ifdef L_BFL_DEBUG
 	std::ofstream file;
@@ -62,23 +72,9 @@ void BFLBody::initialise()
 	file.close();
 #endif
 
-	// Labelling //
-	*GridUtils::logfile << "ObjectManagerBFL: Labelling lattice voxels..." << std::endl;
-
-	int N_lim = _Owner->N_lim;
-	int M_lim = _Owner->M_lim;
-	int K_lim = _Owner->K_lim;
-
-	// Get each marker in turn
-	for (Marker& m : markers) {
-
-		// Label as BFL site
-		_Owner->LatTyp(m.supp_i[0], m.supp_j[0], m.supp_k[0], M_lim, K_lim) = eBFL;
-	}
-
-	// Close Body //
-	*GridUtils::logfile << "ObjectManagerBFL: Checking surface integrity..." << std::endl;
-	enforceSurfaceClosure();
+	// Labelling and closure //
+	*GridUtils::logfile << "ObjectManagerBFL: Labelling lattice voxels and checking surface integrity..." << std::endl;
+	labelSites();
 
 	// Write out closed body marker data
 #ifdef L_BFL_DEBUG
@@ -95,36 +91,20 @@ void BFLBody::initialise()
 
 	// Compute Q //
 	*GridUtils::logfile << "ObjectManagerBFL: Computing Q..." << std::endl;
-
-	// Initialise Q stores to the "invalid" value
-	Q.resize(L_NUM_VELS * markers.size(), -1.0);
-
-	// Loop over local grid and inspect the streaming operations
-	for (int i = 0; i < N_lim; i++) {
-		for (int j = 0; j < M_lim; j++) {
-			for (int k = 0; k < K_lim; k++) {
-
-				// If site is a BFL voxel
-				if (_Owner->LatTyp(i, j, k, M_lim, K_lim) == eBFL) {
-
-					// Compute Q for all stream vectors storing on source voxel BFL marker
-#if (L_DIMS == 3)
-					computeQ(i, j, k, _Owner);
-#else
-					computeQ(i, j, _Owner);
-#endif
-
-				}
-			}
-		}
-	}
-
-	// Computation of Q complete
+	computeSiteQ();
 	*GridUtils::logfile << "ObjectManagerBFL: Q computation complete." << std::endl;
 
 	// Set valid markers
 	validMarkers = GridUtils::onespace(0, static_cast<int>(markers.size()) - 1);
 
+	// Keep the closed body so it can be rebuilt wherever it moves to
+	if (isMovable)
+	{
+		refPositions.reserve(3 * markers.size());
+		for (BFLMarker &m : markers)
+			refPositions.insert(refPositions.end(), m.position.begin(), m.position.end());
+	}
+
 	// Write out Q values for each marker
 #ifdef L_BFL_DEBUG
 	file.open(GridUtils::path_str + "/BflMarkerQs_Rank" + std::to_string(GridUtils::safeGetRank()) + ".out", std::ios::out);
@@ -142,15 +122,205 @@ void BFLBody::initialise()
 
 }
 
+/******************************************************************************/
+/// \brief	Labels the voxels containing markers as BFL sites.
+///
+///			Also rebuilds the voxel index and closes the surface which may add
+///			markers. MOVABLE bodies record the sites they label so they can be
+///			cleared when the body moves.
+void BFLBody::labelSites()
+{
+	int M_lim = _Owner->M_lim;
+	int K_lim = _Owner->K_lim;
+
+	// Get each marker in turn
+	for (Marker& m : markers) {
+
+		// The owning rank keeps the whole body so skip markers off this grid
+		if (GridUtils::isOffGrid(m.supp_i[0], m.supp_j[0], m.supp_k[0], _Owner)) continue;
+
+		// Moving bodies only label fluid sites so they can be restored to fluid
+		eType &type = _Owner->LatTyp(m.supp_i[0], m.supp_j[0], m.supp_k[0], M_lim, K_lim);
+		if (isMovable && type != eFluid) continue;
+
+		// Label as BFL site
+		type = eBFL;
+	}
+
+	// Index the markers by voxel
+	siteMarker.clear();
+	for (size_t m = 0; m < markers.size(); m++)
+		indexMarkerSite(static_cast<int>(m));
+
+	// Close body
+	enforceSurfaceClosure();
+
+	// Record the labelled sites
+	if (isMovable)
+	{
+		labelledSites.clear();
+		for (Marker& m : markers)
+		{
+			if (GridUtils::isOffGrid(m.supp_i[0], m.supp_j[0], m.supp_k[0], _Owner) ||
+				_Owner->LatTyp(m.supp_i[0], m.supp_j[0], m.supp_k[0], M_lim, K_lim) != eBFL) continue;
+			labelledSites.push_back(m.supp_k[0] + m.supp_j[0] * K_lim + m.supp_i[0] * K_lim * M_lim);
+		}
+		std::sort(labelledSites.begin(), labelledSites.end());
+		labelledSites.erase(std::unique(labelledSites.begin(), labelledSites.end()), labelledSites.end());
+	}
+}
+
+/******************************************************************************/
+/// \brief	Computes Q for every BFL voxel of this body on this rank.
+void BFLBody::computeSiteQ()
+{
+	int M_lim = _Owner->M_lim;
+	int K_lim = _Owner->K_lim;
+
+	// Initialise Q stores to the "invalid" value
+	Q.assign(L_NUM_VELS * markers.size(), -1.0);
+
+	// Get the BFL voxels of this body from the voxel index
+	std::vector<int> sites;
+	sites.reserve(siteMarker.size());
+	for (auto& site : siteMarker) sites.push_back(site.first);
+
+	/* Each voxel only writes the Q values of its own marker so the voxels 
+	 * can be processed concurrently. */
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+	for (int s = 0; s < static_cast<int>(sites.size()); s++) {
+
+		int i = sites[s] / (K_lim * M_lim);
+		int j = (sites[s] / K_lim) % M_lim;
+
+		// Compute Q for all stream vectors storing on source voxel BFL marker
+		if (!mesh.empty())
+			computeMeshQ(i, j, sites[s] % K_lim);
+		else
+#if (L_DIMS == 3)
+			computeQ(i, j, sites[s] % K_lim, _Owner);
+#else
+			computeQ(i, j, _Owner);
+#endif
+	}
+}
+
+/******************************************************************************/
+/// \brief	Moves a MOVABLE body by one time step of its prescribed velocity.
+///
+///			Once the body has travelled L_BFL_MOVE_TOL lattice spacings since 
+///			it was last relabelled, the markers are rebuilt from the closed 
+///			body as built and only the sites labelled by the body before and 
+///			after the move are relabelled and have Q recomputed.
+///
+/// \param	vacated	returns the sites which the body no longer labels.
+/// \returns		true if the body was relabelled.
+bool BFLBody::moveBody(std::vector<int> &vacated)
+{
+	int M_lim = _Owner->M_lim;
+	int K_lim = _Owner->K_lim;
+
+	// Advance the displacement
+	double dist = 0.0;
+	for (int d = 0; d < L_DIMS; ++d)
+	{
+		displacement[d] += uWall[d] * _Owner->dt;
+		dist += SQ(displacement[d] - labelledDisp[d]);
+	}
+	vacated.clear();
+	if (dist == 0.0 || std::sqrt(dist) < L_BFL_MOVE_TOL * _Owner->dh) return false;
+	labelledDisp = displacement;
+
+	// Clear the old labels
+	for (int id : labelledSites)
+	{
+		if (_Owner->LatTyp[id] == eBFL) _Owner->LatTyp[id] = eFluid;
+	}
+
+	// Rebuild the markers in their new positions keeping one per fluid voxel
+	markers.clear();
+	siteMarker.clear();
+	std::vector<int> ijk;
+	for (size_t m = 0; m < refPositions.size() / 3; ++m)
+	{
+		double x = refPositions[3 * m] + displacement[eXDirection];
+		double y = refPositions[3 * m + 1] + displacement[eYDirection];
+		double z = refPositions[3 * m + 2] + displacement[eZDirection];
+
+		GridUtils::getEnclosingVoxel(x, y, z, _Owner, &ijk);
+		if (GridUtils::isOffGrid(ijk[0], ijk[1], ijk[2], _Owner)) continue;
+
+		int id = ijk[2] + ijk[1] * K_lim + ijk[0] * K_lim * M_lim;
+		if ((_Owner->LatTyp[id] != eFluid && _Owner->LatTyp[id] != eBFL) || getMarkerAtSite(id) >= 0) continue;
+
+		addMarker(x, y, z, static_cast<int>(m));
+		indexMarkerSite(static_cast<int>(markers.size()) - 1);
+	}
+
+	// Label, close and compute Q in the new position
+	std::vector<int> oldSites;
+	oldSites.swap(labelledSites);
+	labelSites();
+	computeSiteQ();
+	validMarkers = GridUtils::onespace(0, static_cast<int>(markers.size()) - 1);
+
+	// Sites uncovered by the move
+	for (int id : oldSites)
+	{
+		if (_Owner->LatTyp[id] != eBFL) vacated.push_back(id);
+	}
+
+	return true;
+}
+
+/******************************************************************************/
+/// \brief	Adds points which are not on this rank to the body as built.
+///
+///			These are only used to rebuild a MOVABLE body so it is labelled
+///			once it moves onto this rank.
+///
+/// \param	_PCpts	point cloud data.
+void BFLBody::addReferencePoints(PCpts *_PCpts)
+{
+	refPositions.reserve(refPositions.size() + 3 * _PCpts->x.size());
+	for (size_t a = 0; a < _PCpts->x.size(); ++a)
+	{
+		refPositions.push_back(_PCpts->x[a]);
+		refPositions.push_back(_PCpts->y[a]);
+		refPositions.push_back(_PCpts->z[a]);
+	}
+}
+
 /******************************************************************************/
 /// \brief Custom constructor to populate body from array of points.
-/// \param g		hierarchy pointer to grid hierarchy
-/// \param bodyID	ID of body in array of bodies.
-/// \param _PCpts	pointer to point cloud data
-BFLBody::BFLBody(GridObj* g, int bodyID, PCpts* _PCpts) 
+/// \param g			hierarchy pointer to grid hierarchy
+/// \param bodyID		ID of body in array of bodies.
+/// \param _PCpts		pointer to point cloud data
+/// \param moveProperty	enumeration indicating whether the body moves
+BFLBody::BFLBody(GridObj* g, int bodyID, PCpts* _PCpts, eMoveableType moveProperty)
 	: Body(g, bodyID, _PCpts)
 {
-	initialise();
+	initialise(moveProperty);
+}
+
+/******************************************************************************/
+/// \brief Custom constructor to populate body from points sampled on a mesh.
+///
+///			Q is computed by intersecting the lattice links with the mesh 
+///			rather than with the lines between markers.
+///
+/// \param g			hierarchy pointer to grid hierarchy
+/// \param bodyID		ID of body in array of bodies.
+/// \param _PCpts		pointer to point cloud data
+/// \param moveProperty	enumeration indicating whether the body moves
+/// \param surface		surface mesh in global coordinates
+BFLBody::BFLBody(GridObj* g, int bodyID, PCpts* _PCpts, eMoveableType moveProperty, const TriMesh &surface)
+	: Body(g, bodyID, _PCpts), mesh(surface)
+{
+	mesh.buildBins(g->dh);
+	initialise(moveProperty);
 }
 
 
@@ -161,11 +331,12 @@ BFLBody::BFLBody(GridObj* g, int bodyID, PCpts* _PCpts)
 /// \param start_position	start position of base of filament
 /// \param length			length of filament
 /// \param angles			angle of filament
+/// \param moveProperty		enumeration indicating whether the body moves
 BFLBody::BFLBody(GridObj* g, int bodyID, std::vector<double> &start_position,
-	double length, std::vector<double> &angles)
-	: Body(g, bodyID, start_position, length, angles)
+	double length, std::vector<double> &angles, eMoveableType moveProperty)
+	: Body(g, bodyID, start_position, length, angles, 0.0, moveProperty == eMovable)
 {
-	initialise();
+	initialise(moveProperty);
 }
 
 
@@ -175,11 +346,12 @@ BFLBody::BFLBody(GridObj* g, int bodyID, std::vector<double> &start_position,
 /// \param bodyID			ID of body in array of bodies.
 /// \param centre_point		centre point of circle
 /// \param radius			radius of circle
+/// \param moveProperty		enumeration indicating whether the body moves
 BFLBody::BFLBody(GridObj* g, int bodyID, std::vector<double> &centre_point,
-	double radius)
-	: Body(g, bodyID, centre_point, radius)
+	double radius, eMoveableType moveProperty)
+	: Body(g, bodyID, centre_point, radius, moveProperty == eMovable)
 {
-	initialise();
+	initialise(moveProperty);
 }
 
 
@@ -190,11 +362,12 @@ BFLBody::BFLBody(GridObj* g, int bodyID, std::vector<double> &centre_point,
 /// \param centre_point		centre point of square
 /// \param dimensions		dimensions of square
 /// \param angles			angle of square
+/// \param moveProperty		enumeration indicating whether the body moves
 BFLBody::BFLBody(GridObj* g, int bodyID, std::vector<double> &centre_point,
-	std::vector<double> &dimensions, std::vector<double> &angles)
-	: Body(g, bodyID, centre_point, dimensions, angles)
+	std::vector<double> &dimensions, std::vector<double> &angles, eMoveableType moveProperty)
+	: Body(g, bodyID, centre_point, dimensions, angles, moveProperty == eMovable)
 {
-	initialise();
+	initialise(moveProperty);
 }
 
 
@@ -206,11 +379,12 @@ BFLBody::BFLBody(GridObj* g, int bodyID, std::vector<double> &centre_point,
 /// \param length			length of plate
 /// \param width			width of plate
 /// \param angles			angle of plate
+/// \param moveProperty		enumeration indicating whether the body moves
 BFLBody::BFLBody(GridObj* g, int bodyID, std::vector<double> &centre_point,
-	double length, double width, std::vector<double> &angles)
-	: Body(g, bodyID, centre_point, length, width, angles)
+	double length, double width, std::vector<double> &angles, eMoveableType moveProperty)
+	: Body(g, bodyID, centre_point, length, width, angles, moveProperty == eMovable)
 {
-	initialise();
+	initialise(moveProperty);
 }
 
 /******************************************************************************/
@@ -230,7 +404,7 @@ void BFLBody::computeQ(int i, int j, int k, GridObj* g)
 
 	// Declarations
 	int dest_i, dest_j, dest_k, storeID;
-	MarkerData* m_data;
+	int K_lim = g->K_lim, M_lim = g->M_lim;
 
 	/* Get voxel IDs of self and stencil required to specify planes
 	 *
@@ -246,11 +420,8 @@ void BFLBody::computeQ(int i, int j, int k, GridObj* g)
 
 	// TODO: Update under the restrictions we have done for 2D //
 
-	// Get marker data associated with this local site
-	m_data = getMarkerData(g->XPos[i], g->YPos[j], g->ZPos[k]);
-
-	storeID = m_data->ID;
-	delete m_data;
+	// Get marker associated with this local site
+	storeID = getMarkerAtSite(k + j * K_lim + i * K_lim * M_lim);
 
 	// Get list of IDs of neighbour vertices for plane construction
 	std::vector<int> V;
@@ -265,11 +436,9 @@ void BFLBody::computeQ(int i, int j, int k, GridObj* g)
 					)
 				{
 
-					// Fetch data if available
-					m_data = getMarkerData(g->XPos[ii], g->YPos[jj], g->ZPos[kk]);
-
-					// If data valid, then store ID
-					if (m_data->isValid()) V.push_back(m_data->ID);
+					// If there is a marker in the voxel, then store ID
+					int neighID = getMarkerAtSite(kk + jj * K_lim + ii * K_lim * M_lim);
+					if (neighID >= 0) V.push_back(neighID);
 				}
 
 			}
@@ -333,6 +502,19 @@ void BFLBody::computeQ(int i, int j, int k, GridObj* g)
 		src.push_back(_Owner->YPos[j]);
 		src.push_back(_Owner->ZPos[k]);
 
+		// Cross product gives normal vector to plane
+		std::vector<double> n = GridUtils::crossprod(u,v);
+
+		if (GridUtils::vecnorm(n) == 0) continue; // Triangle degenerate
+
+		// Triangle terms of the barycentric test
+		std::vector<double> w0 = GridUtils::subtract(src,local_origin);
+		double a = -GridUtils::dotprod(n,w0);
+		double uu = GridUtils::dotprod(u,u);
+		double uv = GridUtils::dotprod(u,v);
+		double vv = GridUtils::dotprod(v,v);
+		double D = uv * uv - uu * vv;
+
 		// Loop over even velocities and ignore rest distribution to save computing Q twice
 		for (int vel = 0; vel < L_NUM_VELS - 1; vel+=2) {
 
@@ -341,11 +523,6 @@ void BFLBody::computeQ(int i, int j, int k, GridObj* g)
 			dest_j = (j + c[1][vel] + g->M_lim) % g->M_lim;
 			dest_k = (k + c[2][vel] + g->K_lim) % g->K_lim;
 
-			// Cross product gives normal vector to plane
-			std::vector<double> n = GridUtils::crossprod(u,v);
-
-			if (GridUtils::vecnorm(n) == 0) continue; // Triangle degenerate
-
 			// Global position of end of streaming vector
 			std::vector<double> dest;
 			dest.push_back(_Owner->XPos[dest_i]);
@@ -353,8 +530,6 @@ void BFLBody::computeQ(int i, int j, int k, GridObj* g)
 			dest.push_back(_Owner->ZPos[dest_k]);
 
 			std::vector<double> dir = GridUtils::subtract(dest, src);
-			std::vector<double> w0 = GridUtils::subtract(src,local_origin);
-			double a = -GridUtils::dotprod(n,w0);
 			double b = GridUtils::dotprod(n,dir);
 
 			if (abs(b) < L_SMALL_NUMBER) {
@@ -370,13 +545,9 @@ void BFLBody::computeQ(int i, int j, int k, GridObj* g)
 
 			std::vector<double> intersect = GridUtils::add(src, GridUtils::vecmultiply(r,dir) );    // Intersect point
 
-			double uu = GridUtils::dotprod(u,u);
-			double uv = GridUtils::dotprod(u,v);
-			double vv = GridUtils::dotprod(v,v);
 			std::vector<double> w = GridUtils::subtract(intersect, local_origin);
 			double wu = GridUtils::dotprod(w,u);
 			double wv = GridUtils::dotprod(w,v);
-			double D = uv * uv - uu * vv;
 
 			double s = (uv * wv - vv * wu) / D;
 			double t = (uv * wu - uu * wv) / D;
@@ -424,13 +595,10 @@ void BFLBody::computeQ(int i, int j, GridObj* g)
 	// Declarations
 	int dest_i, dest_j;
 	double s, t, s1_x, s1_y, s2_x, s2_y;
-	MarkerData* m_data;
+	int K_lim = g->K_lim, M_lim = g->M_lim;
 	
-	// Get marker data associated with this local site
-	m_data = getMarkerData(g->XPos[i], g->YPos[j], g->ZPos[0]);
-
-	int storeID = m_data->ID;
-	delete m_data;
+	// Get marker associated with this local site
+	int storeID = getMarkerAtSite(j * K_lim + i * K_lim * M_lim);
 
 
 	// Get IDs of vertical and horizontal neighbour vertices for line construction
@@ -446,14 +614,9 @@ void BFLBody::computeQ(int i, int j, GridObj* g)
 				)
 			{			
 
-				// Fetch data if available
-				m_data = getMarkerData(g->XPos[ii], g->YPos[jj], g->ZPos[0]);
-
-				// If data valid, then store ID
-				if (m_data->isValid()) combo.push_back(std::pair<int,int>(storeID, m_data->ID));
-
-				// Clean-up after getMarkerData call
-				delete m_data;
+				// If there is a marker in the voxel, then store ID
+				int neighID = getMarkerAtSite(jj * K_lim + ii * K_lim * M_lim);
+				if (neighID >= 0) combo.push_back(std::pair<int,int>(storeID, neighID));
 
 			}
 
@@ -540,6 +703,41 @@ void BFLBody::computeQ(int i, int j, GridObj* g)
 	}
 }
 
+/******************************************************************************/
+/// \brief	Routine to compute wall distance Q from the surface mesh.
+///
+///			Each lattice link leaving the voxel is intersected with the mesh
+///			directly. The mesh stays where it was built so the link is moved
+///			back by the displacement of the body instead.
+///
+/// \param i local i-index of BFL voxel
+/// \param j local j-index of BFL voxel
+/// \param k local k-index of BFL voxel
+void BFLBody::computeMeshQ(int i, int j, int k)
+{
+	int K_lim = _Owner->K_lim, M_lim = _Owner->M_lim;
+	int storeID = getMarkerAtSite(k + j * K_lim + i * K_lim * M_lim);
+
+	// Position of source site in the frame of the mesh (mid-plane in 2D)
+	double p[3] = { _Owner->XPos[i] - displacement[eXDirection], _Owner->YPos[j] - displacement[eYDirection], 0.0 };
+#if (L_DIMS == 3)
+	p[2] = _Owner->ZPos[k] - displacement[eZDirection];
+#endif
+
+	// Loop over velocities (ignore rest distribution)
+	for (int v = 0; v < L_NUM_VELS - 1; v++) {
+
+		// Position of destination site
+		double ppr[3];
+		for (int d = 0; d < 3; ++d)
+			ppr[d] = p[d] + c_opt[v][d] * _Owner->dh;
+
+		// Store nearest crossing
+		double q = mesh.intersectSegment(p, ppr);
+		if (q >= 0.0) Q[v + L_NUM_VELS * storeID] = q;
+	}
+}
+
 /******************************************************************************/
 ///	\brief	Ensures that BFL body is represented by markers such that there are
 ///			no holes in the surface caused by the voxel grid filter.
@@ -569,13 +767,17 @@ void BFLBody::enforceSurfaceClosure()
 	double len_vec[3];
 	double px, py, pz, av_pos_x, av_pos_y, av_pos_z;
 	std::vector<int> ijk_point;
-	int num_points_in_projection = 20;
-	double projection_spacing = 1.0 / num_points_in_projection;
+	int num_points_in_projection;
+	int max_points_in_projection = 20 * 1024;
+	double projection_spacing;
 
 	/* Loop over every marker in the body (don't use a ranged-for as iterators are 
 	 * invalidated if reallocation is performed when new marker is added. */
 	for (size_t m = 0; m < markers.size(); ++m)
 	{
+		// Skip markers off this grid
+		if (GridUtils::isOffGrid(markers[m].supp_i[0], markers[m].supp_j[0], markers[m].supp_k[0], _Owner)) continue;
+
 		// Check diagonals
 		for (int i =  -1; i <= 1; i += 2)
 		{
@@ -593,9 +795,10 @@ void BFLBody::enforceSurfaceClosure()
 					j_neigh = markers[m].supp_j[0] + j;
 					k_neigh = markers[m].supp_k[0] + k;
 
-					// If diagonal BFL site found
+					// If diagonal BFL site of this body found
 					if (!GridUtils::isOffGrid(i_neigh, j_neigh, k_neigh, _Owner) &&
-						_Owner->LatTyp(i_neigh, j_neigh, k_neigh, M_lim, K_lim) == eBFL)
+						_Owner->LatTyp(i_neigh, j_neigh, k_neigh, M_lim, K_lim) == eBFL &&
+						getMarkerAtSite(k_neigh + j_neigh * K_lim + i_neigh * K_lim * M_lim) >= 0)
 					{
 						// Reset flag
 						bAdjacentConnectionFound = false;
@@ -642,14 +845,16 @@ void BFLBody::enforceSurfaceClosure()
 							start_vec[eYDirection] = markers[m].position[eYDirection];
 							start_vec[eZDirection] = markers[m].position[eZDirection];
 
-							MarkerData *m_data = getMarkerData(_Owner->XPos[i_neigh], _Owner->YPos[j_neigh], _Owner->ZPos[k_neigh]);
-							len_vec[eXDirection] = markers[m_data->ID].position[eXDirection] - start_vec[eXDirection];
-							len_vec[eYDirection] = markers[m_data->ID].position[eYDirection] - start_vec[eYDirection];
-							len_vec[eZDirection] = markers[m_data->ID].position[eZDirection] - start_vec[eZDirection];
-							delete m_data;
+							int neighID = getMarkerAtSite(k_neigh + j_neigh * K_lim + i_neigh * K_lim * M_lim);
+							len_vec[eXDirection] = markers[neighID].position[eXDirection] - start_vec[eXDirection];
+							len_vec[eYDirection] = markers[neighID].position[eYDirection] - start_vec[eYDirection];
+							len_vec[eZDirection] = markers[neighID].position[eZDirection] - start_vec[eZDirection];
 
-							// Start an iterative projection procedure
-							while (!bNewMarkerRequired)
+							/* Start an iterative projection procedure. If the line never 
+							 * leaves the BFL voxels then it passes through their shared 
+							 * corner and no new marker is required. */
+							num_points_in_projection = 20;
+							while (!bNewMarkerRequired && num_points_in_projection < max_points_in_projection)
 							{
 								num_points_in_projection *= 2;
 								projection_spacing = 1.0 / num_points_in_projection;
@@ -696,7 +901,9 @@ void BFLBody::enforceSurfaceClosure()
 								{
 									// Add new marker to the end of the array
 									addMarker(av_pos_x, av_pos_y, av_pos_z, static_cast<int>(markers.size()));
-									_Owner->LatTyp(markers.back().supp_i[0], markers.back().supp_j[0], markers.back().supp_k[0], M_lim, K_lim) = eBFL;
+									eType &type = _Owner->LatTyp(markers.back().supp_i[0], markers.back().supp_j[0], markers.back().supp_k[0], M_lim, K_lim);
+									if (!isMovable || type == eFluid) type = eBFL;
+									indexMarkerSite(static_cast<int>(markers.size()) - 1);
 								}
 
 
@@ -713,4 +920,4 @@ void BFLBody::enforceSurfaceClosure()
 	}	// Loop over markers in the BFL body
 
 } // Method end
-/******************************************************************************/
\ No newline at end of file
+/******************************************************************************/
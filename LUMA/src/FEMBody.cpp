@@ -33,11 +33,15 @@ FEMBody::FEMBody () {
 	DOFsPerNode = 0;
 	DOFsPerElement = 0;
 	systemDOFs = 0;
+	bandwidth = 0;
 	it = 0;
 	res = 0.0;
 	timeav_FEMIterations = 0.0;
 	timeav_FEMResidual = 0.0;
 	BC_DOFs = 0;
+	subIt = 0;
+	relax = L_RELAX;
+	rebuildK = true;
 }
 
 // *****************************************************************************
@@ -64,12 +68,16 @@ FEMBody::FEMBody (IBBody *iBody, std::vector<double> &start_position, double len
 	// Set members to default values
 	iBodyPtr = iBody;
 	DOFsPerNode = 3;
-	DOFsPerElement = 6;
+	DOFsPerElement = L_FEM_EL_DOFS;
 	systemDOFs = (nElements + 1) * DOFsPerNode;
+	bandwidth = DOFsPerElement - 1;
 	it = 0;
 	res = 0.0;
 	timeav_FEMIterations = 0.0;
 	timeav_FEMResidual = 0.0;
+	subIt = 0;
+	relax = L_RELAX;
+	rebuildK = true;
 
 	// Set number of DOFs to remove in BC
 	if (clamped == true)
@@ -116,8 +124,8 @@ FEMBody::FEMBody (IBBody *iBody, std::vector<double> &start_position, double len
 	computeNodeMapping(nIBMNodes, nFEMNodes);
 
 	// Resize the matrices and set to zero
-	M.resize(systemDOFs, std::vector<double>(systemDOFs, 0.0));
-	K.resize(systemDOFs, std::vector<double>(systemDOFs, 0.0));
+	M.resize((2 * bandwidth + 1) * systemDOFs, 0.0);
+	K.resize((2 * bandwidth + 1) * systemDOFs, 0.0);
 	R.resize(systemDOFs, 0.0);
 	F.resize(systemDOFs, 0.0);
 	U.resize(systemDOFs, 0.0);
@@ -155,6 +163,7 @@ void FEMBody::dynamicFEM () {
 
 	// Set while counter to zero
 	it = 0;
+	double resPrev = 0.0;
 
 	// While loop for FEM solver
 	do {
@@ -165,11 +174,22 @@ void FEMBody::dynamicFEM () {
 		// Check residual
 		res = checkNRConvergence();
 
+#ifdef L_FEM_MODIFIED_NEWTON
+		// Refactorise if the old effective stiffness is no longer converging fast enough
+		if (it > 0 && res > L_FEM_MODIFIED_NEWTON * resPrev)
+			rebuildK = true;
+#endif
+		resPrev = res;
+
 		// Increment counter
 		it++;
 
 	} while (res > TOL && it < MAXIT);
 
+	// Start the next solve with a fresh effective stiffness if this one failed
+	if (res > TOL)
+		rebuildK = true;
+
 	// Calculate velocities and accelerations
 	finishNewmark();
 
@@ -181,11 +201,17 @@ void FEMBody::dynamicFEM () {
 ///	\brief	Newton-Raphson routine for solving non-linear FEM
 void FEMBody::newtonRaphsonIterator () {
 
+	/* With modified Newton the factorised effective stiffness is kept
+	 * until the convergence rate drops, otherwise it is rebuilt every time */
+#ifndef L_FEM_MODIFIED_NEWTON
+	rebuildK = true;
+#endif
+
 	// Set matrices to zero
 	fill(F.begin(), F.end(), 0.0);
-	for (int i = 0; i < systemDOFs; i++) {
-		fill(M[i].begin(), M[i].end(), 0.0);
-		fill(K[i].begin(), K[i].end(), 0.0);
+	if (rebuildK) {
+		fill(M.begin(), M.end(), 0.0);
+		fill(K.begin(), K.end(), 0.0);
 	}
 
 	// Loop through and build global matrices
@@ -194,18 +220,27 @@ void FEMBody::newtonRaphsonIterator () {
 		// Build force vector
 		elements[el].forceVector();
 
-		// Build mass matrix
-		elements[el].massMatrix();
+		if (rebuildK) {
+
+			// Build mass matrix
+			elements[el].massMatrix();
 
-		// Build stiffness matrix
-		elements[el].stiffMatrix();
+			// Build stiffness matrix
+			elements[el].stiffMatrix();
+		}
 	}
 
 	// Apply Newmark scheme (using Newmark coefficients)
-	setNewmark();
+	setNewmark(rebuildK);
+
+	// Factorise effective stiffness using LAPACK library (elements only couple neighbouring nodes so it is banded)
+	if (rebuildK) {
+		GridUtils::factoriseBandedSystem(K, bandwidth, bandwidth, Kfact, Kpiv, BC_DOFs);
+		rebuildK = false;
+	}
 
-	// Solve linear system using LAPACK library
-	delU = GridUtils::solveLinearSystem(K, F, BC_DOFs);
+	// Solve linear system
+	delU = GridUtils::solveFactorisedBandedSystem(Kfact, Kpiv, bandwidth, bandwidth, F, BC_DOFs);
 
 	// Add deltaU to U
 	for (int i = 0; i < systemDOFs; i++) {
@@ -257,10 +292,12 @@ void FEMBody::finishNewmark () {
 // *****************************************************************************
 ///	\brief	First step in Newmark-Beta time integration
 ///
-///	\param	M_hat		mass matrix with BCs applied
-///	\param	K_hat		stiffness matrix with BCs applied
-///	\param	RmF_hat		balanced load vector with BCs applied
-void FEMBody::setNewmark () {
+///			Forms the effective load vector and, if requested, the effective
+///			stiffness matrix. Without the stiffness the mass matrix has not
+///			been assembled so inertia forces are computed element by element.
+///
+///	\param	withStiffness		form the effective stiffness matrix as well
+void FEMBody::setNewmark (bool withStiffness) {
 
 	// Newmark-beta method for time integration
 	double Dt = iBodyPtr->_Owner->dt;
@@ -276,17 +313,25 @@ void FEMBody::setNewmark () {
 	}
 
 	// Multiply with mass matrix to get inertia forces
-	std::vector<double> MF_hat = GridUtils::matrix_multiply(M, Meff_hat);
+	std::vector<double> MF_hat;
+	if (withStiffness) {
+		MF_hat = GridUtils::bandMatrix_multiply(M, bandwidth, bandwidth, Meff_hat);
+	}
+	else {
+		MF_hat.assign(systemDOFs, 0.0);
+		for (size_t el = 0; el < elements.size(); el++)
+			elements[el].inertiaVector(Meff_hat, MF_hat);
+	}
 
-	// Calculate effective load vector and stiffness matrix
+	// Calculate effective load vector
 	for (int i = 0; i < systemDOFs; i++) {
-
-		// Effective load
 		F[i] = R[i] - F[i] + MF_hat[i];
+	}
 
-		// Effective stiffness
-		for (int j = 0; j < systemDOFs; j++) {
-			K[i][j] += a0 * M[i][j];
+	// Effective stiffness (M and K share the same band structure)
+	if (withStiffness) {
+		for (size_t i = 0; i < K.size(); i++) {
+			K[i] += a0 * M[i];
 		}
 	}
 }
@@ -330,7 +375,9 @@ void FEMBody::updateIBMarkers() {
 	// Parameters
 	std::vector<double> dashU;
 	std::vector<double> dashUdot;
+	std::vector<double> localU(DOFsPerElement), localUdot(DOFsPerElement);
 	std::vector<std::vector<double>> T(L_DIMS, std::vector<double>(L_DIMS, 0.0));
+	std::vector<double> femVel(IBNodeParents.size() * L_DIMS, 0.0);
 
 	// Loop through all IBM nodes
 	for (size_t node = 0; node < IBNodeParents.size(); node++) {
@@ -344,8 +391,16 @@ void FEMBody::updateIBMarkers() {
 		dashUdot = el->disassembleGlobalMat(Udot);
 
 		// Get element values in local coordinates
-		dashU = GridUtils::matrix_multiply(el->T, dashU);
-		dashUdot = GridUtils::matrix_multiply(el->T, dashUdot);
+		for (int i = 0; i < DOFsPerElement; i++) {
+			localU[i] = 0.0;
+			localUdot[i] = 0.0;
+			for (int k = 0; k < DOFsPerElement; k++) {
+				localU[i] += el->T[i][k] * dashU[k];
+				localUdot[i] += el->T[i][k] * dashUdot[k];
+			}
+		}
+		dashU.swap(localU);
+		dashUdot.swap(localUdot);
 
 		// Multiply by shape functions
 		dashU = el->shapeFuns(dashU, zeta);
@@ -362,10 +417,102 @@ void FEMBody::updateIBMarkers() {
 		// Set the IBM node
 		for (int d = 0; d < L_DIMS; d++) {
 			iBodyPtr->markers[node].position[d] = iBodyPtr->markers[node].position0[d] + dashU[d];
+			femVel[node * L_DIMS + d] = dashUdot[d];
+		}
+	}
+
+	// Relax the marker velocities
+	relaxMarkerVelocities(femVel);
+}
+
+
+// *****************************************************************************
+///	\brief	Set the new IBM marker velocities from the FEM ones
+///
+///			The residual is the difference between the FEM marker velocities 
+///			and the marker velocities the fluid was given. With constant 
+///			relaxation the new velocity is the old one plus L_RELAX times the 
+///			residual. Aitken relaxation updates the factor every sub-iteration 
+///			from the last two residuals. IQN-ILS builds a least-squares model 
+///			of the inverse Jacobian from all sub-iterations of the time step 
+///			(Degroote et al. 2009, Comput. Struct.). Both start from L_RELAX.
+///
+///	\param	femVel	FEM marker velocities (flattened by marker then direction)
+void FEMBody::relaxMarkerVelocities(std::vector<double> &femVel) {
+
+	// Get residual and store old velocity for the convergence check
+	std::vector<double> residual(femVel.size());
+	for (size_t node = 0; node < IBNodeParents.size(); node++) {
+		for (int d = 0; d < L_DIMS; d++) {
 			iBodyPtr->markers[node].markerVel_km1[d] = iBodyPtr->markers[node].markerVel[d];
-			iBodyPtr->markers[node].markerVel[d] = L_RELAX * dashUdot[d] + (1.0 - L_RELAX) * iBodyPtr->markers[node].markerVel_km1[d];
+			residual[node * L_DIMS + d] = femVel[node * L_DIMS + d] - iBodyPtr->markers[node].markerVel[d];
 		}
 	}
+
+	// Relaxation factor
+	std::vector<double> newVel(femVel.size());
+	if (L_FSI_COUPLING == eFSIAitken && subIt > 0) {
+
+		// Aitken factor from the change in residual
+		double num = 0.0, den = 0.0;
+		for (size_t i = 0; i < residual.size(); i++) {
+			double dr = residual[i] - fsiResidual_km1[i];
+			num += fsiResidual_km1[i] * dr;
+			den += dr * dr;
+		}
+		if (den > 0.0)
+			relax = -relax * num / den;
+
+		// Keep within sensible bounds
+		relax = std::max(std::min(relax, 1.0), 1e-3);
+	}
+	else
+		relax = L_RELAX;
+
+	for (size_t i = 0; i < residual.size(); i++)
+		newVel[i] = relax * femVel[i] + (1.0 - relax) * iBodyPtr->markers[i / L_DIMS].markerVel_km1[i % L_DIMS];
+
+	// Add the latest differences to the model and apply the least-squares update
+	if (L_FSI_COUPLING == eFSIIQNILS && subIt > 0) {
+		std::vector<double> dr(residual.size()), dv(residual.size());
+		for (size_t i = 0; i < residual.size(); i++) {
+			dr[i] = residual[i] - fsiResidual_km1[i];
+			dv[i] = femVel[i] - fsiOutput_km1[i];
+		}
+		iqnV.insert(iqnV.begin(), dr);
+		iqnW.insert(iqnW.begin(), dv);
+
+		// Find coefficients minimising |V.c + r|
+		std::vector<double> c = GridUtils::solveLeastSquares(iqnV, GridUtils::vecmultiply(-1.0, residual));
+		newVel = femVel;
+		for (size_t col = 0; col < iqnW.size(); col++) {
+			for (size_t i = 0; i < newVel.size(); i++)
+				newVel[i] += iqnW[col][i] * c[col];
+		}
+	}
+
+	// Set the new marker velocities
+	for (size_t node = 0; node < IBNodeParents.size(); node++) {
+		for (int d = 0; d < L_DIMS; d++)
+			iBodyPtr->markers[node].markerVel[d] = newVel[node * L_DIMS + d];
+	}
+
+	// Store for the next sub-iteration
+	fsiResidual_km1.swap(residual);
+	fsiOutput_km1 = femVel;
+	subIt++;
+}
+
+
+// *****************************************************************************
+///	\brief	Start the FSI coupling of a new time step
+///
+///			Clears the sub-iteration history so relaxation starts again from 
+///			L_RELAX.
+void FEMBody::resetCoupling() {
+	subIt = 0;
+	iqnV.clear();
+	iqnW.clear();
 }
 
 
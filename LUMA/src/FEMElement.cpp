@@ -38,6 +38,11 @@ FEMElement::FEMElement () {
 	density = 0;
 	angles = 0.0;
 	I = 0.0;
+	for (int i = 0; i < L_FEM_EL_DOFS; i++) {
+		F[i] = 0.0;
+		for (int j = 0; j < L_FEM_EL_DOFS; j++)
+			T[i][j] = Mlocal[i][j] = 0.0;
+	}
 }
 
 
@@ -84,8 +89,12 @@ FEMElement::FEMElement (FEMBody *f, int i, int elDOFs, double spacing, double he
 	for (int i = 0; i < fPtr->DOFsPerElement; i++)
 		DOFs.push_back(ID * fPtr->DOFsPerNode + i);
 
-	// Resize transformation matrix
-	T.resize(elDOFs, std::vector<double>(elDOFs, 0.0));
+	// Initialise transformation matrix, mass matrix and internal forces to zero
+	for (int i = 0; i < L_FEM_EL_DOFS; i++) {
+		F[i] = 0.0;
+		for (int j = 0; j < L_FEM_EL_DOFS; j++)
+			T[i][j] = Mlocal[i][j] = 0.0;
+	}
 
 	// Set to correct values
 	T[0][0] = T[1][1] =  T[3][3] = T[4][4] = cos(angles);
@@ -93,8 +102,30 @@ FEMElement::FEMElement (FEMBody *f, int i, int elDOFs, double spacing, double he
 	T[1][0] = T[4][3] = -sin(angles);
 	T[2][2] = T[5][5] =  1.0;
 
-	// Initialise internal forces to zero
-	F.resize(elDOFs, 0.0);
+	// Mass matrix coefficients
+	double C1 = density * area * length0 / 420.0;
+
+	// Set local mass matrix (does not change with deformation so only built once)
+	Mlocal[0][0] = C1 * 140.0;
+	Mlocal[0][3] = C1 * 70.0;
+	Mlocal[1][1] = C1 * 156.0;
+	Mlocal[1][2] = C1 * 22.0 * length0;
+	Mlocal[1][4] = C1 * 54;
+	Mlocal[1][5] = C1 * (-13.0 * length0);
+	Mlocal[2][2] = C1 * 4.0 * SQ(length0);
+	Mlocal[2][4] = C1 * 13.0 * length0;
+	Mlocal[2][5] = C1 * (-3.0 * SQ(length0));
+	Mlocal[3][3] = C1 * 140.0;
+	Mlocal[4][4] = C1 * 156.0;
+	Mlocal[4][5] = C1 * (-22.0 * length0);
+	Mlocal[5][5] = C1 * 4.0 * SQ(length0);
+
+	// Copy to the lower half (symmetrical matrix)
+	for (int i = 1; i < L_FEM_EL_DOFS; i++) {
+		for (int j = 0; j < i; j++) {
+			Mlocal[i][j] = Mlocal[j][i];
+		}
+	}
 }
 
 
@@ -130,11 +161,10 @@ std::vector<double> FEMElement::shapeFuns(const std::vector<double> &vec, double
 ///	\brief	Construct elemental load vector
 void FEMElement::loadVector () {
 
-	// Initialise arrays and matrices for calculating load vector
-	std::vector<std::vector<double>> Tsub(L_DIMS, std::vector<double>(L_DIMS, 0.0));
-	std::vector<double> Rlocal(fPtr->DOFsPerElement, 0.0);
-	std::vector<double> RGlobal;
-	std::vector<double> F;
+	// Initialise arrays for calculating load vector
+	double Rlocal[L_FEM_EL_DOFS];
+	double RGlobal[L_FEM_EL_DOFS];
+	double F[2];
 
 	// Get force scaling parameter
 	double forceScale = fPtr->iBodyPtr->_Owner->dm / SQ(fPtr->iBodyPtr->_Owner->dt);
@@ -147,12 +177,15 @@ void FEMElement::loadVector () {
 		double a = IBChildNodes[node].zeta1;
 		double b = IBChildNodes[node].zeta2;
 
-		// Get subset of transpose matrix
-		Tsub = {{T[0][0], T[0][1]},
-			    {T[1][0], T[1][1]}};
-
-		// Convert force to local coordinates
-		F = GridUtils::matrix_multiply(Tsub, GridUtils::vecmultiply(fPtr->iBodyPtr->markers[IBnode].epsilon * 1.0 * forceScale, fPtr->iBodyPtr->markers[IBnode].force_xyz));
+		// Convert force to local coordinates using subset of transformation matrix
+		double fx = fPtr->iBodyPtr->markers[IBnode].epsilon * 1.0 * forceScale * fPtr->iBodyPtr->markers[IBnode].force_xyz[eXDirection];
+		double fy = fPtr->iBodyPtr->markers[IBnode].epsilon * 1.0 * forceScale * fPtr->iBodyPtr->markers[IBnode].force_xyz[eYDirection];
+		F[0] = 0.0;
+		F[0] += T[0][0] * fx;
+		F[0] += T[0][1] * fy;
+		F[1] = 0.0;
+		F[1] += T[1][0] * fx;
+		F[1] += T[1][1] * fy;
 
 		// Get the nodal values by integrating over range of IB point
 		Rlocal[0] = F[0] * 0.5 * length * (0.5 * b - 0.5 * a + 0.25 * SQ(a) - 0.25 * SQ(b));
@@ -163,7 +196,7 @@ void FEMElement::loadVector () {
 		Rlocal[5] = F[1] * 0.5 * length * (length * (-SQ(a) * SQ(a) + SQ(b) * SQ(b)) / 32.0 + length * (-TH(a) + TH(b)) / 24.0 - length * (-SQ(a) + SQ(b)) / 16.0 - length * (b - a) / 8.0);
 
 		// Get element internal forces
-		RGlobal = GridUtils::matrix_multiply(GridUtils::matrix_transpose(T), Rlocal);
+		localToGlobal(Rlocal, RGlobal);
 
 		// Assemble into global vector
 		assembleGlobalMat(RGlobal, fPtr->R);
@@ -175,36 +208,11 @@ void FEMElement::loadVector () {
 ///	\brief	Construct elemental mass matrix
 void FEMElement::massMatrix () {
 
-	// Initialise arrays and matrices for calculating mass matrix
-	std::vector<std::vector<double>> Mlocal(fPtr->DOFsPerElement, std::vector<double>(fPtr->DOFsPerElement, 0.0));
-
-	// Coefficients
-	double C1 = density * area * length0 / 420.0;
-
-	// Set local mass matrix
-	Mlocal[0][0] = C1 * 140.0;
-	Mlocal[0][3] = C1 * 70.0;
-	Mlocal[1][1] = C1 * 156.0;
-	Mlocal[1][2] = C1 * 22.0 * length0;
-	Mlocal[1][4] = C1 * 54;
-	Mlocal[1][5] = C1 * (-13.0 * length0);
-	Mlocal[2][2] = C1 * 4.0 * SQ(length0);
-	Mlocal[2][4] = C1 * 13.0 * length0;
-	Mlocal[2][5] = C1 * (-3.0 * SQ(length0));
-	Mlocal[3][3] = C1 * 140.0;
-	Mlocal[4][4] = C1 * 156.0;
-	Mlocal[4][5] = C1 * (-22.0 * length0);
-	Mlocal[5][5] = C1 * 4.0 * SQ(length0);
-
-	// Copy to the lower half (symmetrical matrix)
-	for (int i = 1; i < fPtr->DOFsPerElement; i++) {
-		for (int j = 0; j < i; j++) {
-			Mlocal[i][j] = Mlocal[j][i];
-		}
-	}
+	// Global mass matrix for single element
+	double Mglobal[L_FEM_EL_DOFS][L_FEM_EL_DOFS];
 
 	// Multiply by transformation matrices to get global matrix for single element
-	std::vector<std::vector<double>> Mglobal = GridUtils::matrix_multiply(GridUtils::matrix_multiply(GridUtils::matrix_transpose(T), Mlocal), T);
+	localToGlobal(Mlocal, Mglobal);
 
 	// Assemble into global matrix
 	assembleGlobalMat(Mglobal, fPtr->M);
@@ -216,7 +224,8 @@ void FEMElement::massMatrix () {
 void FEMElement::stiffMatrix () {
 
 	// Initialise arrays and matrices for calculating linear stiffness matrix
-	std::vector<std::vector<double>> Klocal(fPtr->DOFsPerElement, std::vector<double>(fPtr->DOFsPerElement, 0.0));
+	double Klocal[L_FEM_EL_DOFS][L_FEM_EL_DOFS] = {};
+	double Kglobal[L_FEM_EL_DOFS][L_FEM_EL_DOFS];
 
 	// Construct upper half of local stiffness matrix for single element
 	Klocal[0][0] = E * area / length0;
@@ -234,7 +243,7 @@ void FEMElement::stiffMatrix () {
 	Klocal[5][5] = 4.0 * E * I / length0;
 
 	// Copy to the lower half (symmetrical matrix)
-	for (int i = 1; i < fPtr->DOFsPerElement; i++) {
+	for (int i = 1; i < L_FEM_EL_DOFS; i++) {
 		for (int j = 0; j < i; j++) {
 			Klocal[i][j] = Klocal[j][i];
 		}
@@ -259,7 +268,7 @@ void FEMElement::stiffMatrix () {
 	Klocal[4][4] += F0 / length0;
 
 	// Multiply by transformation matrices to get global matrix for single element
-	std::vector<std::vector<double>> Kglobal = GridUtils::matrix_multiply(GridUtils::matrix_multiply(GridUtils::matrix_transpose(T), Klocal), T);
+	localToGlobal(Klocal, Kglobal);
 
 	// Assemble into global matrix
 	assembleGlobalMat(Kglobal, fPtr->K);
@@ -293,22 +302,99 @@ void FEMElement::forceVector () {
 	F[5] = M2;
 
 	// Get element internal forces
-	std::vector<double> FGlobal = GridUtils::matrix_multiply(GridUtils::matrix_transpose(T), F);
+	double FGlobal[L_FEM_EL_DOFS];
+	localToGlobal(F, FGlobal);
 
 	// Assemble into global vector
 	assembleGlobalMat(FGlobal, fPtr->F);
 }
 
 
+// *****************************************************************************
+///	\brief	Add elemental inertia forces to global vector
+///
+///			Equivalent to assembling the mass matrix and multiplying by the
+///			accelerations but without building the global matrix.
+///
+///	\param	acc					global vector of accelerations
+///	\param	globalVec			global vector
+void FEMElement::inertiaVector (const std::vector<double> &acc, std::vector<double> &globalVec) {
+
+	// Accelerations in local coordinates
+	double accLocal[L_FEM_EL_DOFS], MAlocal[L_FEM_EL_DOFS], MAGlobal[L_FEM_EL_DOFS];
+	for (int i = 0; i < L_FEM_EL_DOFS; i++) {
+		accLocal[i] = 0.0;
+		for (int k = 0; k < L_FEM_EL_DOFS; k++)
+			accLocal[i] += T[i][k] * acc[DOFs[k]];
+	}
+
+	// Local inertia forces
+	for (int i = 0; i < L_FEM_EL_DOFS; i++) {
+		MAlocal[i] = 0.0;
+		for (int k = 0; k < L_FEM_EL_DOFS; k++)
+			MAlocal[i] += Mlocal[i][k] * accLocal[k];
+	}
+
+	// Assemble into global vector
+	localToGlobal(MAlocal, MAGlobal);
+	assembleGlobalMat(MAGlobal, globalVec);
+}
+
+
+// *****************************************************************************
+///	\brief	Transform local elemental vector to global coordinates
+///
+///	\param	localVec			elemental vector in local coordinates
+///	\param	globalVec			elemental vector in global coordinates
+void FEMElement::localToGlobal (const double (&localVec)[L_FEM_EL_DOFS], double (&globalVec)[L_FEM_EL_DOFS]) {
+
+	// Multiply by transpose of transformation matrix
+	for (int i = 0; i < L_FEM_EL_DOFS; i++) {
+		globalVec[i] = 0.0;
+		for (int k = 0; k < L_FEM_EL_DOFS; k++)
+			globalVec[i] += T[k][i] * localVec[k];
+	}
+}
+
+
+// *****************************************************************************
+///	\brief	Transform local elemental matrix to global coordinates
+///
+///			Forms T^T.A.T one row at a time so no intermediate matrix is needed.
+///
+///	\param	localMat			elemental matrix in local coordinates
+///	\param	globalMat			elemental matrix in global coordinates
+void FEMElement::localToGlobal (const double (&localMat)[L_FEM_EL_DOFS][L_FEM_EL_DOFS], double (&globalMat)[L_FEM_EL_DOFS][L_FEM_EL_DOFS]) {
+
+	double rowTA[L_FEM_EL_DOFS];
+	for (int i = 0; i < L_FEM_EL_DOFS; i++) {
+
+		// Row i of T^T.A
+		for (int j = 0; j < L_FEM_EL_DOFS; j++) {
+			rowTA[j] = 0.0;
+			for (int k = 0; k < L_FEM_EL_DOFS; k++)
+				rowTA[j] += T[k][i] * localMat[k][j];
+		}
+
+		// Row i of T^T.A.T
+		for (int j = 0; j < L_FEM_EL_DOFS; j++) {
+			globalMat[i][j] = 0.0;
+			for (int k = 0; k < L_FEM_EL_DOFS; k++)
+				globalMat[i][j] += rowTA[k] * T[k][j];
+		}
+	}
+}
+
+
 // *****************************************************************************
 ///	\brief	Assemble global vector from local elemental vector
 ///
 ///	\param	localVec			elemental vector
 ///	\param	globalVec			global vector
-void FEMElement::assembleGlobalMat (const std::vector<double> &localVec, std::vector<double> &globalVec) {
+void FEMElement::assembleGlobalMat (const double (&localVec)[L_FEM_EL_DOFS], std::vector<double> &globalVec) {
 
 	// Loop through and set
-	for (size_t i = 0; i < localVec.size(); i++)
+	for (int i = 0; i < L_FEM_EL_DOFS; i++)
 		globalVec[DOFs[i]] += localVec[i];
 }
 
@@ -317,17 +403,18 @@ void FEMElement::assembleGlobalMat (const std::vector<double> &localVec, std::ve
 ///	\brief	Assemble global matrix from local elemental matrix
 ///
 ///	\param	localMat			elemental matrix
-///	\param	globalMat			global matrix
-void FEMElement::assembleGlobalMat (const std::vector<std::vector<double>> &localMat, std::vector<std::vector<double>> &globalMat) {
-
-	// Get rows and cols
-	size_t rows = localMat.size();
-	size_t cols = localMat[0].size();
-
-	// Now loop through and set
-	for (size_t i = 0; i < rows; i++) {
-		for (size_t j = 0; j < cols; j++) {
-			globalMat[DOFs[i]][DOFs[j]] += localMat[i][j];
+///	\param	globalMat			global matrix in band storage
+void FEMElement::assembleGlobalMat (const double (&localMat)[L_FEM_EL_DOFS][L_FEM_EL_DOFS], std::vector<double> &globalMat) {
+
+	// Leading dimension of band storage
+	int bw = fPtr->bandwidth;
+	int LDA = 2 * bw + 1;
+
+	// Now loop through and set (element DOFs are contiguous)
+	for (int j = 0; j < L_FEM_EL_DOFS; j++) {
+		double *col = &globalMat[bw + DOFs[j] * LDA - DOFs[j]];
+		for (int i = 0; i < L_FEM_EL_DOFS; i++) {
+			col[DOFs[i]] += localMat[i][j];
 		}
 	}
 }
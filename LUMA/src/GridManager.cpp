@@ -336,8 +336,8 @@ bool GridManager::createWritableDataStore(GridObj const * const targetGrid)
 		p_data->k_end = 0;
 
 #ifdef L_BUILD_FOR_MPI
-		// No transition layers on L0 and halo won't exist if MPI dimension is 1
-		if (MpiManager::getInstance()->dimensions[eXDirection] == 1)
+		// No transition layers on L0 and halo won't exist if block spans the domain
+		if (!MpiManager::getInstance()->has_halo[eXDirection])
 		{
 			p_data->i_end = N_lim - 1;
 			p_data->i_start = 0;
@@ -348,7 +348,7 @@ bool GridManager::createWritableDataStore(GridObj const * const targetGrid)
 			p_data->i_start = 1;
 		}
 
-		if (MpiManager::getInstance()->dimensions[eYDirection] == 1)
+		if (!MpiManager::getInstance()->has_halo[eYDirection])
 		{
 			p_data->j_end = M_lim - 1;
 			p_data->j_start = 0;
@@ -359,7 +359,7 @@ bool GridManager::createWritableDataStore(GridObj const * const targetGrid)
 			p_data->j_start = 1;
 		}
 #if (L_DIMS == 3)
-		if (MpiManager::getInstance()->dimensions[eZDirection] == 1)
+		if (!MpiManager::getInstance()->has_halo[eZDirection])
 		{
 			p_data->k_end = K_lim - 1;
 			p_data->k_start = 0;
@@ -743,4 +743,239 @@ long GridManager::getCellCount(int targetLevel, int targetRegion, double *bounds
 #else
 	return static_cast<long>(volume / (local_cell_size * local_cell_size));
 #endif
-}
\ No newline at end of file
+}
+///	\brief	Estimates the load of the bodies in the geometry file for use in 
+///			the decomposition cost model.
+///
+///			The decomposition is computed before any bodies are built so the 
+///			prefab bodies in the geometry file are read here to estimate their
+///			bounding boxes and number of markers. Markers are assumed to be 
+///			spaced at the lattice spacing of the grid on which the body is 
+///			built. Bodies read from point cloud files are not included as their
+///			extent is not known until the file is read.
+void GridManager::estimateBodyLoads()
+{
+	bodyLoads.clear();
+
+#ifdef L_GEOMETRY_FILE
+
+	// Open config file (missing file is reported when the bodies are built)
+	std::ifstream file;
+	file.open("./input/geometry.config", std::ios::in);
+	if (!file.is_open()) return;
+
+	// Bodies are shifted if using walls
+	double shift[3] = { 0.0, 0.0, 0.0 };
+	if (L_WALL_LEFT == eSolid) shift[eXDirection] = L_WALL_THICKNESS_LEFT;
+	if (L_WALL_BOTTOM == eSolid) shift[eYDirection] = L_WALL_THICKNESS_BOTTOM;
+	if (L_WALL_FRONT == eSolid) shift[eZDirection] = L_WALL_THICKNESS_FRONT;
+
+	int numSkipped = 0;
+	double totalCost = 0.0;
+	std::string line;
+	while (std::getline(file, line))
+	{
+		// Skip comments and blank lines
+		std::istringstream iss(line);
+		std::string bodyCase, boundaryType;
+		if (!(iss >> bodyCase) || bodyCase[0] == '#') continue;
+		iss >> boundaryType;
+
+		// Cost of a marker depends on the type of body
+		double markerCost;
+		if (boundaryType == "IBM") markerCost = L_MPI_SD_COST_IBM;
+		else if (boundaryType == "BFL") markerCost = L_MPI_SD_COST_BFL - L_MPI_SD_COST_FLUID;
+		else continue;
+
+		// Point clouds cannot be estimated without reading the file
+		if (bodyCase == "FROM_FILE")
+		{
+			numSkipped++;
+			continue;
+		}
+
+		// Grid on which the body is built
+		int lev, reg;
+		iss >> lev >> reg;
+		if (lev < 0 || lev > L_NUM_LEVELS) continue;
+		double dh = L_COARSE_SITE_WIDTH / pow(2, lev);
+
+		/* Bounding boxes are described by a centre and half-width. Surface 
+		 * measure is the length (2D) or area (3D) over which markers are placed. */
+		std::vector< std::vector<double> > centres, halfWidths;
+		double surface = 0.0;
+
+		if (bodyCase == "FILAMENT_ARRAY")
+		{
+			int nFil;
+			double start[3], spacing[3], length, height, depth, angleVert, angleHorz;
+			iss >> nFil >> start[0] >> start[1] >> start[2] >> spacing[0] >> spacing[1] >> spacing[2]
+				>> length >> height >> depth >> angleVert >> angleHorz;
+
+			// Direction of each filament
+			double dir[3];
+			dir[0] = cos(angleVert * L_PI / 180.0) * cos(angleHorz * L_PI / 180.0);
+			dir[1] = sin(angleVert * L_PI / 180.0);
+			dir[2] = cos(angleVert * L_PI / 180.0) * sin(angleHorz * L_PI / 180.0);
+
+			// One box per filament
+			for (int i = 0; i < nFil; ++i)
+			{
+				std::vector<double> centre(3), halfWidth(3);
+				for (int d = 0; d < 3; ++d)
+				{
+					centre[d] = start[d] + shift[d] + i * spacing[d] + 0.5 * length * dir[d];
+					halfWidth[d] = 0.5 * length * std::abs(dir[d]);
+				}
+				centres.push_back(centre);
+				halfWidths.push_back(halfWidth);
+			}
+			surface = length;
+		}
+		else
+		{
+			double centre[3];
+			iss >> centre[0] >> centre[1] >> centre[2];
+			double halfWidth = 0.0;
+
+			if (bodyCase == "CIRCLE_SPHERE")
+			{
+				double radius; iss >> radius;
+				halfWidth = radius;
+#if (L_DIMS == 3)
+				surface = 4.0 * L_PI * radius * radius;
+#else
+				surface = 2.0 * L_PI * radius;
+#endif
+			}
+			else if (bodyCase == "SQUARE_CUBE")
+			{
+				double length, height, depth;
+				iss >> length >> height >> depth;
+#if (L_DIMS == 3)
+				halfWidth = 0.5 * sqrt(length * length + height * height + depth * depth);
+				surface = 2.0 * (length * height + length * depth + height * depth);
+#else
+				halfWidth = 0.5 * sqrt(length * length + height * height);
+				surface = 2.0 * (length + height);
+#endif
+			}
+			else if (bodyCase == "PLATE")
+			{
+				double length, width;
+				iss >> length >> width;
+				halfWidth = 0.5 * sqrt(length * length + width * width);
+#if (L_DIMS == 3)
+				surface = length * width;
+#else
+				surface = length;
+#endif
+			}
+			else continue;
+
+			// Rotation is accounted for by using the half-diagonal in every direction
+			centres.push_back({ centre[0] + shift[0], centre[1] + shift[1], centre[2] + shift[2] });
+			halfWidths.push_back({ halfWidth, halfWidth, halfWidth });
+		}
+
+		// Number of markers on each box and cost per coarse time step
+#if (L_DIMS == 3)
+		double numMarkers = surface / (dh * dh) + 1.0;
+#else
+		double numMarkers = surface / dh + 1.0;
+#endif
+		double cost = numMarkers * markerCost * pow(2, lev);
+
+		// Store the loads (boxes padded by a site for the support)
+		for (size_t b = 0; b < centres.size(); ++b)
+		{
+			BodyLoad load;
+			for (int d = 0; d < 3; ++d)
+			{
+				load.bounds[2 * d] = centres[b][d] - halfWidths[b][d] - dh;
+				load.bounds[2 * d + 1] = centres[b][d] + halfWidths[b][d] + dh;
+			}
+			load.cost = cost;
+			bodyLoads.push_back(load);
+			totalCost += cost;
+		}
+	}
+	file.close();
+
+	if (bodyLoads.size())
+	{
+		L_INFO("Decomposition cost model includes " + std::to_string(bodyLoads.size()) + 
+			" bodies adding an estimated " + std::to_string(totalCost) + " site updates per time step.", GridUtils::logfile);
+	}
+	if (numSkipped)
+	{
+		L_INFO(std::to_string(numSkipped) + " bodies read from file are not included in the decomposition cost model.", GridUtils::logfile);
+	}
+
+#endif	// L_GEOMETRY_FILE
+}
+
+///	\brief	Returns the estimated cost of a coarse time step within the bounds
+///			supplied for use in the decomposition.
+///
+///			The active operation count is weighted by the cost of a fluid site
+///			and then corrected for the domain walls and the estimated body 
+///			loads using the site costs in the definitions. Costs are in units 
+///			of a fluid site update so the result is comparable with the active
+///			operation count.
+///
+///	\param	bounds	pointer to an array containing the bounds of the region to be considered.
+///	\returns		estimated cost within the bounds specified.
+double GridManager::getBlockCost(double *bounds)
+{
+	// Active sites
+	double cost = L_MPI_SD_COST_FLUID * static_cast<double>(getActiveCellCount(bounds, true));
+
+	// Walls are labelled on L0 over a slab of the given thickness
+	const eType wallType[6] = 
+		{ L_WALL_LEFT, L_WALL_RIGHT, L_WALL_BOTTOM, L_WALL_TOP, L_WALL_FRONT, L_WALL_BACK };
+	const double wallThickness[6] = 
+		{ L_WALL_THICKNESS_LEFT, L_WALL_THICKNESS_RIGHT, L_WALL_THICKNESS_BOTTOM,
+		L_WALL_THICKNESS_TOP, L_WALL_THICKNESS_FRONT, L_WALL_THICKNESS_BACK };
+	for (int w = 0; w < 2 * L_DIMS; ++w)
+	{
+		if (wallType[w] == eFluid) continue;
+		double siteCost = (wallType[w] == eSolid) ? L_MPI_SD_COST_SOLID : L_MPI_SD_COST_BOUNDARY;
+
+		// Union of the wall slab and the bounds
+		double wallBounds[6];
+		bool bOverlaps = true;
+		for (int e = 0; e < 6; ++e) wallBounds[e] = global_edges[e][0];
+		if (w % 2 == 0) wallBounds[w + 1] = wallThickness[w];
+		else wallBounds[w - 1] = global_edges[w][0] - wallThickness[w];
+		for (int d = 0; d < L_DIMS; ++d)
+		{
+			wallBounds[2 * d] = std::max(wallBounds[2 * d], bounds[2 * d]);
+			wallBounds[2 * d + 1] = std::min(wallBounds[2 * d + 1], bounds[2 * d + 1]);
+			if (wallBounds[2 * d + 1] <= wallBounds[2 * d]) bOverlaps = false;
+		}
+		if (!bOverlaps) continue;
+
+		cost += (siteCost - L_MPI_SD_COST_FLUID) * static_cast<double>(getCellCount(0, 0, &wallBounds[0]));
+	}
+
+	// Bodies contribute the fraction of their bounding box within the bounds
+	for (BodyLoad& load : bodyLoads)
+	{
+		double fraction = 1.0;
+		for (int d = 0; d < L_DIMS; ++d)
+		{
+			double overlap = std::min(bounds[2 * d + 1], load.bounds[2 * d + 1]) - 
+				std::max(bounds[2 * d], load.bounds[2 * d]);
+			if (overlap <= 0.0)
+			{
+				fraction = 0.0;
+				break;
+			}
+			fraction *= overlap / (load.bounds[2 * d + 1] - load.bounds[2 * d]);
+		}
+		cost += fraction * load.cost;
+	}
+
+	return cost;
+}
@@ -50,7 +50,7 @@ GridObj::~GridObj(void)
 /// \param level always should be zero as top level grid.
 GridObj::GridObj(int level)
 	: t(0), level(level), region_number(0),
-	timeav_mpi_overhead(0.0), timeav_timestep(0.0),
+	timeav_mpi_overhead(0.0), timeav_timestep(0.0), timeav_ibm(0.0),
 	refinement_ratio(1.0 / pow(2.0, static_cast<double>(level)))
 {
 	// Set limits of refinement to zero as top level
@@ -78,7 +78,7 @@ GridObj::GridObj(int level)
 GridObj::GridObj(int RegionNumber, GridObj& pGrid)
 	: t(0), level(pGrid.level + 1), region_number(RegionNumber),
 	parentGrid(&pGrid), refinement_ratio(1.0 / pow(2.0, static_cast<double>(pGrid.level + 1))),
-	timeav_mpi_overhead(0.0), timeav_timestep(0.0)
+	timeav_mpi_overhead(0.0), timeav_timestep(0.0), timeav_ibm(0.0)
 {	
 	// Notify user that grid constructor has been called
 	L_INFO("Constructing Sub-Grid level " + std::to_string(level) +
@@ -117,6 +117,49 @@ void GridObj::LBM_addSubGrid(int RegionNumber)
 
 }
 
+// ****************************************************************************
+/// \brief	Re-initialise this grid and its sub-grids in place.
+///
+///			Used when the domain is redecomposed at run time. Grid objects keep 
+///			their addresses so pointers held by bodies remain valid. The 
+///			hierarchy itself cannot be restructured in place so the method 
+///			reports whether the new decomposition gives this rank the same 
+///			sub-grids as before. Any sub-grid which no longer matches is left 
+///			untouched.
+///
+/// \returns	true if the sub-grid hierarchy on this rank is unchanged.
+bool GridObj::LBM_reinitialiseGrid()
+{
+	// Position vectors are built by appending so must be emptied first
+	XPos.clear();
+	YPos.clear();
+	ZPos.clear();
+
+	// Call the appropriate initialiser
+	if (level == 0) LBM_initGrid();
+	else LBM_initSubGrid(*parentGrid);
+
+	// Check the sub-grids which should exist against those which do
+	bool bUnchanged = true;
+	if (level == L_NUM_LEVELS) return bUnchanged;
+
+	for (int reg = 0; reg < L_NUM_REGIONS; ++reg)
+	{
+		// Below L0 a grid only has children of its own region
+		if (level != 0 && reg != region_number) continue;
+
+		GridObj *child = nullptr;
+		for (GridObj *g : subGrid) if (g->region_number == reg) child = g;
+
+		if (GridUtils::intersectsRefinedRegion(*this, reg) != (child != nullptr))
+			bUnchanged = false;
+		else if (child && !child->LBM_reinitialiseGrid())
+			bUnchanged = false;
+	}
+
+	return bUnchanged;
+}
+
 // ****************************************************************************
 // ****************************************************************************
 // Other member methods are in their own files prefixed GridObj_
@@ -25,6 +25,7 @@
 
 #include "../inc/stdafx.h"
 #include "../inc/GridObj.h"
+#include "../inc/ObjectManager.h"
 
 using namespace std;
 
@@ -208,20 +209,20 @@ void GridObj::LBM_initGrid() {
 	
 	// Create position vectors using receiver layers as reference positions for wrapping
 	// X
-	if (MpiManager::getInstance()->dimensions[eXDirection] == 1)
+	if (!MpiManager::getInstance()->has_halo[eXDirection])
 		LBM_initPositionVector(gm->global_edges[eXMin][0] + dh / 2.0, gm->global_edges[eXMax][0] - dh / 2.0, eXDirection);
 	else
 		LBM_initPositionVector(mpim->recv_layer_pos.X[eLeftMin] + dh / 2.0, mpim->recv_layer_pos.X[eRightMax] - dh / 2.0, eXDirection);
 
 	// Y
-	if (MpiManager::getInstance()->dimensions[eYDirection] == 1)
+	if (!MpiManager::getInstance()->has_halo[eYDirection])
 		LBM_initPositionVector(gm->global_edges[eYMin][0] + dh / 2.0, gm->global_edges[eYMax][0] - dh / 2.0, eYDirection);
 	else
 		LBM_initPositionVector(mpim->recv_layer_pos.Y[eLeftMin] + dh / 2.0, mpim->recv_layer_pos.Y[eRightMax] - dh / 2.0, eYDirection);
 
 	// Z
 #if (L_DIMS == 3)
-	if (MpiManager::getInstance()->dimensions[eZDirection] == 1)
+	if (!MpiManager::getInstance()->has_halo[eZDirection])
 		LBM_initPositionVector(gm->global_edges[eZMin][0] + dh / 2.0, gm->global_edges[eZMax][0] - dh / 2.0, eZDirection);
 	else
 		LBM_initPositionVector(mpim->recv_layer_pos.Z[eLeftMin] + dh / 2.0, mpim->recv_layer_pos.Z[eRightMax] - dh / 2.0, eZDirection);
@@ -1213,6 +1214,124 @@ void GridObj::LBM_initRefinedLab (GridObj& pGrid) {
 
 }
 
+// ****************************************************************************
+/// \brief	Builds the list of streaming links cut by BFL bodies.
+///
+///			Each link records the site it streams into, the direction, the Q 
+///			value and the body and marker it belongs to. Links are ordered by 
+///			site so streaming only visits the links of the site being updated.
+///			If both sites of a link are BFL sites then the wall nearest the 
+///			site being updated is favoured. Links of MOVABLE bodies also store 
+///			the moving wall correction. Called once all the BFL bodies have 
+///			been built and again whenever a moving body is relabelled.
+void GridObj::LBM_initBFLLinks()
+{
+	// Get BFL bodies on this grid
+	std::vector<BFLBody> &pBody = ObjectManager::getInstance()->pBody;
+	std::vector<int> bodies;
+	for (int b = 0; b < static_cast<int>(pBody.size()); ++b)
+	{
+		if (pBody[b]._Owner == this) bodies.push_back(b);
+	}
+
+	bflLinks.clear();
+	bflLinkStart.clear();
+	if (bodies.empty()) return;
+
+	// Build the links site by site
+	bflLinkStart.resize(N_lim * M_lim * K_lim + 1, 0);
+	for (int i = 0; i < N_lim; ++i)
+	{
+		for (int j = 0; j < M_lim; ++j)
+		{
+			for (int k = 0; k < K_lim; ++k)
+			{
+				int id = k + j * K_lim + i * K_lim * M_lim;
+				bflLinkStart[id] = static_cast<int>(bflLinks.size());
+
+				for (int v = 0; v < L_NUM_VELS; ++v)
+				{
+					// Source site (periodic by default)
+					int src_x = (i - c_opt[v][0] + N_lim) % N_lim;
+					int src_y = (j - c_opt[v][1] + M_lim) % M_lim;
+					int src_z = (k - c_opt[v][2] + K_lim) % K_lim;
+					int src_id = src_z + src_y * K_lim + src_x * K_lim * M_lim;
+
+					if (LatTyp[id] != eBFL && LatTyp[src_id] != eBFL) continue;
+
+					// Wall nearer current site
+					bool bLinkFound = false;
+					if (LatTyp[id] == eBFL)
+					{
+						for (int b : bodies)
+						{
+							int markerID = pBody[b].getMarkerAtSite(id);
+							if (markerID < 0) continue;
+							double q = pBody[b].Q[GridUtils::getOpposite(v) + L_NUM_VELS * markerID];
+							if (q == -1) continue;
+
+							/* Interpolation stencil must be on this rank. If not 
+							 * then it is likely a halo site which will get 
+							 * overwritten anyway so stream as normal. */
+							int stencil_i = i + c_opt[v][0];
+							int stencil_j = j + c_opt[v][1];
+							int stencil_k = k + c_opt[v][2];
+							if (stencil_i >= 0 && stencil_i < N_lim &&
+								stencil_j >= 0 && stencil_j < M_lim &&
+								stencil_k >= 0 && stencil_k < K_lim)
+							{
+								double cu = _LBM_bflWallVelocity(pBody[b], v);
+								bflLinks.emplace_back(id, v, q, b, markerID, true, 
+									2.0 * w[v] * cu / SQ(cs));
+							}
+							bLinkFound = true;
+							break;
+						}
+					}
+
+					// Wall nearer source site
+					if (!bLinkFound)
+					{
+						for (int b : bodies)
+						{
+							int markerID = pBody[b].getMarkerAtSite(src_id);
+							if (markerID < 0) continue;
+							double q = pBody[b].Q[v + L_NUM_VELS * markerID];
+							if (q == -1) continue;
+
+							double cu = _LBM_bflWallVelocity(pBody[b], v);
+							bflLinks.emplace_back(id, v, q, b, markerID, false, 
+								(cu == 0.0) ? 0.0 : w[v] * cu / (SQ(cs) * (1.0 - q)));
+							break;
+						}
+					}
+				}
+			}
+		}
+	}
+	bflLinkStart.back() = static_cast<int>(bflLinks.size());
+
+	// Moving bodies rebuild the links every time step so only report periodically
+	if (t % L_GRID_OUT_FREQ == 0)
+		*GridUtils::logfile << "Grid " << level << ": " << bflLinks.size() << " BFL links built." << std::endl;
+}
+
+// ****************************************************************************
+/// \brief	Wall velocity of a BFL body projected onto a lattice direction.
+///
+/// \param	body	BFL body.
+/// \param	v		lattice direction.
+/// \returns		projected wall velocity in lattice units (zero for static bodies).
+double GridObj::_LBM_bflWallVelocity(const BFLBody &body, int v)
+{
+	if (!body.isMovable) return 0.0;
+
+	double cu = 0.0;
+	for (int d = 0; d < L_DIMS; ++d)
+		cu += c_opt[v][d] * body.uWall[d];
+	return cu * dt / dh;
+}
+
 // ****************************************************************************
 /// \brief	Method to import an input profile from a file.
 ///
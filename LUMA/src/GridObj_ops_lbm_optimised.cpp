@@ -51,6 +51,10 @@ void GridObj::LBM_multi_opt(int subcycle)
 	// Get object manager instance
 	ObjectManager *objman = ObjectManager::getInstance();
 
+	// Move BFL bodies with prescribed motion and relabel the sites around them
+	if (objman->hasMovableBFLBodies[level])
+		objman->bfl_moveBodies(this);
+
 	// If IBM is on then reset the forces
 #ifdef L_IBM_ON
 	if (objman->hasIBMBodies[level])
@@ -59,12 +63,15 @@ void GridObj::LBM_multi_opt(int subcycle)
 
 	// Start the clock to time this kernel
 	clock_t secs, t_start = clock();
+	clock_t ibm_secs = 0;
 
 #ifdef L_LD_OUT
 	// Reset object forces for momentum exchange force calculation
 	objman->resetMomexBodyForces(this);
 #endif
 
+#ifdef L_IBM_ON
+
 	// Loop over grid
 #ifdef L_ENABLE_OPENMP
 #pragma omp parallel for
@@ -75,39 +82,7 @@ void GridObj::LBM_multi_opt(int subcycle)
 		{
 			for (int k = 0; k < K_lim; ++k)
 			{
-				// Local index and type
-				int id = k + j * K_lim + i * K_lim * M_lim;
-				eType type_local = LatTyp[id];
-
-				// MOMENTUM EXCHANGE //
-#ifdef L_LD_OUT
-				if (type_local == eSolid)
-				{
-					// Compute lift and drag contribution of this site
-					objman->computeLiftDrag(i, j, k, this);
-				}
-#endif
-				// IGNORE THESE SITES //
-				if (type_local == eRefined || type_local == eSolid
-#ifndef L_REGULARISED_BOUNDARIES
-					|| type_local == eVelocity
-#endif
-					) continue;
-
-				// STREAM //
-				_LBM_stream_opt(i, j, k, id, type_local, subcycle);
-
-				// REGULARISED BCs //
-#ifdef L_REGULARISED_BOUNDARIES
-				if (type_local == eVelocity || type_local == ePressure)
-					_LBM_regularised_opt(i, j, k, id, type_local, subcycle);
-#endif
-
-				// MACROSCOPIC //
-				_LBM_macro_opt(i, j, k, id, type_local);
-
-				// If IBM is on then split loop and perform IBM step
-#ifdef L_IBM_ON
+				_LBM_streamMacroSite_opt(i, j, k, subcycle);
 			}
 		}
 	}
@@ -118,43 +93,93 @@ void GridObj::LBM_multi_opt(int subcycle)
 
 	// Perform IBM steps (interpolate, force calc, spread and update macro)
 	if (objman->hasIBMBodies[level])
+	{
+		clock_t ibm_start = clock();
 		objman->ibm_apply(this, true);
+		ibm_secs = clock() - ibm_start;
+	}
 
+#endif
 
-	// Loop over grid
+#if (defined L_BUILD_FOR_MPI && defined L_MPI_OVERLAP_COMMS)
+
+	/* Sites within the halo band (sender and receiver layers) are updated 
+	 * first so their post-collision values are ready to be sent. One thread 
+	 * then drives the halo exchange while the remaining threads update the 
+	 * interior, which neither reads nor writes anything the exchange touches. 
+	 * The communication thread joins the interior work once its receives 
+	 * are complete. */
+	MpiManager *mpim = MpiManager::getInstance();
+	int halo = static_cast<int>(pow(2, level + 1));
+
+	// Halo band
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
 	for (int i = 0; i < N_lim; ++i)
 	{
 		for (int j = 0; j < M_lim; ++j)
 		{
 			for (int k = 0; k < K_lim; ++k)
 			{
-				// Local index and type
-				int id = k + j * K_lim + i * K_lim * M_lim;
-				eType type_local = LatTyp[id];
+				if (!_LBM_isHaloBandSite(i, j, k, halo)) continue;
+				_LBM_finalSite_opt(i, j, k, subcycle);
+			}
+		}
+	}
 
+	// Interior overlapped with halo exchange
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel
+#endif
+	{
+#ifdef L_ENABLE_OPENMP
+#ifdef L_MPI_THREAD_MULTIPLE
+#pragma omp single nowait
+#else
+#pragma omp master
 #endif
-
-				// FORCING //
-#if (defined L_IBM_ON || defined L_GRAVITY_ON)
-				// Do not force solid sites
-				if (type_local != eSolid)
-					_LBM_forceGrid_opt(id);
 #endif
-				// COLLIDE //
-				if (type_local != eTransitionToCoarser) // Do not collide on UpperTL
-				{ 
+		mpim->mpi_communicateBegin(level, region_number, true);
 
-#ifdef L_USE_KBC_COLLISION
-					_LBM_kbcCollide_opt(id);
+#ifdef L_ENABLE_OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+		for (int i = halo; i < N_lim - halo; ++i)
+		{
+			for (int j = halo; j < M_lim - halo; ++j)
+			{
+#if (L_DIMS == 3)
+				for (int k = halo; k < K_lim - halo; ++k)
 #else
-					_LBM_collide_opt(id);
+				for (int k = 0; k < K_lim; ++k)
 #endif
+				{
+					_LBM_finalSite_opt(i, j, k, subcycle);
 				}
+			}
+		}
+	}
+
+#else
 
+	// Loop over grid
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+	for (int i = 0; i < N_lim; ++i)
+	{
+		for (int j = 0; j < M_lim; ++j)
+		{
+			for (int k = 0; k < K_lim; ++k)
+			{
+				_LBM_finalSite_opt(i, j, k, subcycle);
 			}
 		}
 	}
 
+#endif
+
 	// Swap distributions
 	f.swap(fNew);
 
@@ -177,6 +202,11 @@ void GridObj::LBM_multi_opt(int subcycle)
 	timeav_timestep += ((double)secs) / CLOCKS_PER_SEC;
 	timeav_timestep /= t;
 
+	// Update average time of the IBM steps on this grid
+	timeav_ibm *= (t - 1);
+	timeav_ibm += ((double)ibm_secs) / CLOCKS_PER_SEC;
+	timeav_ibm /= t;
+
 	if (t % L_GRID_OUT_FREQ == 0) {
 		// Performance data to logfile
 		*GridUtils::logfile << "Grid " << level << ": Time stepping taking an average of " << timeav_timestep * 1000 << "ms" << std::endl;
@@ -185,11 +215,134 @@ void GridObj::LBM_multi_opt(int subcycle)
 	// MPI COMMUNICATION //
 #ifdef L_BUILD_FOR_MPI
 
+#ifdef L_MPI_OVERLAP_COMMS
+	// Exchange already done so just unpack the received halo
+	mpim->mpi_communicateEnd(level, region_number);
+#else
 	// Launch communication on this grid by passing its level and region number
 	MpiManager::getInstance()->mpi_communicate(level, region_number);
+#endif
+
+#endif
+
+}
+
+// *****************************************************************************
+/// \brief	Stream and macroscopic update of a single site.
+///
+///			Also accumulates the momentum exchange contribution of solid sites.
+///
+/// \param	i			x-index of current site.
+/// \param	j			y-index of current site.
+/// \param	k			z-index of current site.
+///	\param	subcycle	sub-cycle being performed.
+///	\returns			false if the site is not updated by the LBM kernel.
+bool GridObj::_LBM_streamMacroSite_opt(int i, int j, int k, int subcycle)
+{
+	// Local index and type
+	int id = k + j * K_lim + i * K_lim * M_lim;
+	eType type_local = LatTyp[id];
+
+	// MOMENTUM EXCHANGE //
+#ifdef L_LD_OUT
+	if (type_local == eSolid)
+	{
+		// Compute lift and drag contribution of this site
+		ObjectManager::getInstance()->computeLiftDrag(i, j, k, this);
+	}
+#endif
+	// IGNORE THESE SITES //
+	if (type_local == eRefined || type_local == eSolid
+#ifndef L_REGULARISED_BOUNDARIES
+		|| type_local == eVelocity
+#endif
+		) return false;
+
+	// STREAM //
+	_LBM_stream_opt(i, j, k, id, type_local, subcycle);
 
+	// REGULARISED BCs //
+#ifdef L_REGULARISED_BOUNDARIES
+	if (type_local == eVelocity || type_local == ePressure)
+		_LBM_regularised_opt(i, j, k, id, type_local, subcycle);
+#endif
+
+	// MACROSCOPIC //
+	_LBM_macro_opt(i, j, k, id, type_local);
+
+	return true;
+}
+
+// *****************************************************************************
+/// \brief	Forcing and collision of a single site.
+///
+/// \param	i			x-index of current site.
+/// \param	j			y-index of current site.
+/// \param	k			z-index of current site.
+void GridObj::_LBM_forceCollideSite_opt(int i, int j, int k)
+{
+	// Local index and type
+	int id = k + j * K_lim + i * K_lim * M_lim;
+	eType type_local = LatTyp[id];
+
+	// FORCING //
+#if (defined L_IBM_ON || defined L_GRAVITY_ON)
+	// Do not force solid sites
+	if (type_local != eSolid)
+		_LBM_forceGrid_opt(id);
+#endif
+	// COLLIDE //
+	if (type_local != eTransitionToCoarser) // Do not collide on UpperTL
+	{ 
+
+#ifdef L_USE_KBC_COLLISION
+		_LBM_kbcCollide_opt(id);
+#else
+		_LBM_collide_opt(id);
+#endif
+	}
+}
+
+// *****************************************************************************
+/// \brief	Final pass of the LBM kernel on a single site.
+///
+///			When IBM is on the stream and macroscopic update have already been 
+///			done in a separate pass so only forcing and collision remain. 
+///			Otherwise the whole kernel is fused into a single pass.
+///
+/// \param	i			x-index of current site.
+/// \param	j			y-index of current site.
+/// \param	k			z-index of current site.
+///	\param	subcycle	sub-cycle being performed.
+void GridObj::_LBM_finalSite_opt(int i, int j, int k, int subcycle)
+{
+#ifdef L_IBM_ON
+	_LBM_forceCollideSite_opt(i, j, k);
+#else
+	if (_LBM_streamMacroSite_opt(i, j, k, subcycle))
+		_LBM_forceCollideSite_opt(i, j, k);
 #endif
+}
 
+// *****************************************************************************
+/// \brief	Checks whether a site lies within the halo band of the local grid.
+///
+///			The halo band is every site within the sender or receiver layers 
+///			at any edge of the local grid, i.e. every site read or written by 
+///			the MPI halo exchange.
+///
+/// \param	i		x-index of current site.
+/// \param	j		y-index of current site.
+/// \param	k		z-index of current site.
+/// \param	halo	combined thickness of sender and receiver layers.
+///	\returns		true if in the halo band.
+bool GridObj::_LBM_isHaloBandSite(int i, int j, int k, int halo)
+{
+	return (i < halo || i >= N_lim - halo || j < halo || j >= M_lim - halo
+#if (L_DIMS == 3)
+		|| k < halo || k >= K_lim - halo
+#endif
+		);
 }
 
 
@@ -221,13 +374,6 @@ void GridObj::_LBM_stream_opt(int i, int j, int k, int id, eType type_local, int
 		int src_id = src_z + src_y * K_lim + src_x * K_lim * M_lim;
 		src_type_local = LatTyp[src_id];
 
-		// BFL BOUNCEBACK
-		if (type_local == eBFL || src_type_local == eBFL)
-		{
-			// Try to apply BFL BC on streaming link
-			if (_LBM_applyBFL_opt(id, src_id, v, i, j, k, src_x, src_y, src_z)) continue;
-		}
-
 		// SLIP CONDITIONS //
 		if (type_local == eSlip)
 		{
@@ -286,6 +432,10 @@ void GridObj::_LBM_stream_opt(int i, int j, int k, int id, eType type_local, int
 
 	}
 
+	// BFL BOUNCEBACK //
+	if (!bflLinkStart.empty())
+		_LBM_applyBFL_opt(i, j, k, id);
+
 }
 
 // *****************************************************************************
@@ -984,124 +1134,62 @@ void GridObj::_LBM_forceGrid_opt(int id) {
 // *****************************************************************************
 /// \brief	Optimised BFL application.
 ///
-///			Applies the BFL boundary condition at the present site. BFL site may
-///			be either source or current site and so this method will decide
-///			appropriate action based on each case as well as wall location.
-///			Currently only first BFL body considered.
+///			Applies the BFL boundary condition on the links of the present site
+///			which are cut by a BFL body, overwriting the regular streamed values.
+///			The wall may be nearer either the present site or the source site 
+///			and the link records which so the appropriate interpolation is used.
+///			Links of moving bodies add the moving wall correction.
 ///
-/// \param	id		flattened ijk index.
-///	\param	src_id	flatted ijk index of the source site.
-///	\param	v		lattice direction.
-///	\param	i		x-index of current site.
-///	\param	j		y-index of current site.
-///	\param	k		z-index of current site.
-///	\param	src_x	x-index of site where value is pulled from.
-///	\param	src_y	y-index of site where value is pulled from.
-///	\param	src_z	z-index of site where value is pulled from.
-///	\return	boolen a indicator as to whether BFL was applied. If not, regular streaming is continued.
-bool GridObj::_LBM_applyBFL_opt(int id, int src_id, int v, int i, int j, int k, int src_x, int src_y, int src_z)
+///	\param	i	x-index of current site.
+///	\param	j	y-index of current site.
+///	\param	k	z-index of current site.
+/// \param	id	flattened ijk index.
+void GridObj::_LBM_applyBFL_opt(int i, int j, int k, int id)
 {
-	/* BFL can be applied easily if only one of the two sites are labelled as BFL.
-	 * If both are labelled BFL, the algorithm here checks to see if there is any 
-	 * intersecting wall assuming only one wall per voxel. If there are two 
-	 * intersecting walls, then the BC favours the nearest. */
-
-	// Initiate marker data store pointer on stack and retrieve Q
-	MarkerData *m_data;
-	double q_link = -1;		// Set to invalid value by default
-	bool bCurrentSiteBflSite = true;
-	int markerID;
-
-	// Check whether current site is BFL site and get Q value
-	if (LatTyp(i, j, k, M_lim, K_lim) == eBFL)
+	for (int l = bflLinkStart[id]; l < bflLinkStart[id + 1]; ++l)
 	{
-		m_data = ObjectManager::getInstance()->pBody[0].getMarkerData(XPos[i], YPos[j], ZPos[k]);
-		markerID = m_data->ID;
-		delete m_data;
-		q_link = ObjectManager::getInstance()->pBody[0].Q[GridUtils::getOpposite(v) + L_NUM_VELS * markerID];
-		
-	}
+		const BFLLink &link = bflLinks[l];
+		int v = link.v;
+		double q_link = link.q;
 
-	/* If q value is valid then current site is a BFL site with link-intersecting 
-	 * wall. If not, then we can check to see if the source site is a BFL site 
-	 * and has a link-intersecting wall. */
-	if (q_link == -1)
-	{
-		m_data = ObjectManager::getInstance()->pBody[0].getMarkerData(XPos[src_x], YPos[src_y], ZPos[src_z]);
-		if (m_data->isValid())
+		// Intersection and wall must be nearer current site than source site //
+		if (link.bWallNearSite)
 		{
-			bCurrentSiteBflSite = false;
-			markerID = m_data->ID;
-			q_link = ObjectManager::getInstance()->pBody[0].Q[v + L_NUM_VELS * markerID];
-		}
-		delete m_data;
-	}
-		
-	/* BFL BC must only be applied if the pull link intersects the wall. Wall may
-	 * or may not intersect the pull link hence this method must handle the case 
-	 * where either the source site or the current site is BFL. If 
-	 * q_link == -1, there is no wall intersection between the current
-	 * site and the source site on that link. */
-
-	// No intersection //
-	if (q_link == -1)
-	{
-		// Regular stream as no intersection
-		return false;
-	}
+			/* Here, the wall can be considered to be closer to BFL site but we need 
+			 * to perform interpolation on pre-stream values pointing towards the
+			 * wall from the BFL site and one site further away from the wall. 
+			 * The stencil was checked to be on this rank when the link was built. */
+			int stencil_id = k + j * K_lim + i * K_lim * M_lim;
 
-	// Intersection and wall must be nearer current site than source site //
-	else if (bCurrentSiteBflSite)
-	{
-		/* Here, the wall can be considered to be closer to BFL site but we need 
-		 * to perform interpolation on pre-stream values pointing towards the
-		 * wall from the BFL site and one site further away from the wall. This
-		 * stencil site can be found from the pull direction unit vector. */
-		int stencil_i = i + c_opt[v][0];
-		int stencil_j = j + c_opt[v][1];
-		int stencil_k = k + c_opt[v][2];
-		int stencil_id = k + j * K_lim + i * K_lim * M_lim;
-
-		/* Only apply if the stencil is valid on this rank. Otherwise, doesn't 
-		 * matter as it is likely a halo site which will get overwritten anyway. */
-		if (stencil_i >= 0 && stencil_i < N_lim &&
-			stencil_j >= 0 && stencil_j < M_lim &&
-			stencil_k >= 0 && stencil_k < K_lim)
-		{
 			// Interpolate pre-stream value then perform bounceback stream
 			fNew[v + id * L_NUM_VELS] =
 				(1 - 2 * q_link) *
 				(f[GridUtils::getOpposite(v) + stencil_id * L_NUM_VELS] - f[GridUtils::getOpposite(v) + id * L_NUM_VELS])
 				+ f[GridUtils::getOpposite(v) + id * L_NUM_VELS];
+		}
 
-			// Momentum exchange -- don't include forces computed on halo sites to avoid duplicates
-#ifdef L_LD_OUT
-			if (!GridUtils::isOnRecvLayer(XPos[i], YPos[j], ZPos[k]))
-				ObjectManager::getInstance()->computeLiftDrag(v, id, this, markerID);
-#endif
+		// Intersection and wall must be nearer source site than current site //
+		else
+		{
+			/* Wall must be nearer the source site than the current site. We can 
+			 * compute bounced value at current site from post-stream interpolated
+			 * values pointing away from the wall. */
+			fNew[v + id * L_NUM_VELS] =
+				(1 - 2 * q_link) *
+				((f[v + id * L_NUM_VELS] - f[GridUtils::getOpposite(v) + id * L_NUM_VELS]) / (2 - 2 * q_link))
+				+ f[GridUtils::getOpposite(v) + id * L_NUM_VELS];
 		}
-	}
 
-	// Intersection and wall must be nearer source site than current site //
-	else
-	{
-		/* Wall must be nearer the source site than the current site. We can 
-		 * compute bounced value at current site from post-stream interpolated
-		 * values pointing away from the wall. */
-		fNew[v + id * L_NUM_VELS] =
-			(1 - 2 * q_link) *
-			((f[v + id * L_NUM_VELS] - f[GridUtils::getOpposite(v) + id * L_NUM_VELS]) / (2 - 2 * q_link))
-			+ f[GridUtils::getOpposite(v) + id * L_NUM_VELS];
+		// Moving wall correction (MOVABLE bodies only)
+		if (link.wallTerm != 0.0)
+			fNew[v + id * L_NUM_VELS] += link.wallTerm * rho[id];
 
 		// Momentum exchange -- don't include forces computed on halo sites to avoid duplicates
 #ifdef L_LD_OUT
 		if (!GridUtils::isOnRecvLayer(XPos[i], YPos[j], ZPos[k]))
-			ObjectManager::getInstance()->computeLiftDrag(v, id, this, markerID);
+			ObjectManager::getInstance()->computeLiftDrag(v, id, this, link.bodyID, link.markerID);
 #endif
 	}
-
-	return true;
-
 }
 
 // *****************************************************************************
@@ -1329,6 +1417,27 @@ void GridObj::_LBM_resetForces()
 }
 
 
+// *****************************************************************************
+/// \brief	Resets the body force to zero at the given sites only.
+///
+///			Equivalent to _LBM_resetForces() without gravity when the force 
+///			elsewhere is already zero.
+///
+///	\param	sites	flattened indices of the sites to reset
+void GridObj::_LBM_resetForces(const std::vector<int> &sites)
+{
+	int numSites = static_cast<int>(sites.size());
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+	for (int s = 0; s < numSites; ++s)
+	{
+		for (int d = 0; d < L_DIMS; ++d)
+			force_xyz[d + sites[s] * L_DIMS] = 0.0;
+	}
+}
+
+
 // *****************************************************************************
 /// \brief	Method to update macroscopic quantities on the fly and extrapolate from them.
 ///
@@ -386,6 +386,287 @@ std::vector<double> GridUtils::solveLinearSystem(std::vector<std::vector<double>
 	return b;
 }
 
+// *****************************************************************************
+///	\brief	Solve the banded linear system A.x = b
+///
+///			A is stored by diagonals, column by column, as for LAPACK band
+///			storage without the extra rows needed for fill-in, so element 
+///			(i,j) is at A[ku + i - j + j * (kl + ku + 1)]. The first BC 
+///			unknowns are removed from the system and set to zero.
+///
+///	\param	A		A matrix in band storage
+///	\param	kl		number of sub-diagonals
+///	\param	ku		number of super-diagonals
+///	\param	b		b vector (RHS)
+///	\param	BC		number of unknowns removed
+///	\return	x
+std::vector<double> GridUtils::solveBandedLinearSystem(const std::vector<double> &A, int kl, int ku, std::vector<double> b, int BC) {
+
+	// Factorise and solve
+	std::vector<double> ab;
+	std::vector<int> ipiv;
+	factoriseBandedSystem(A, kl, ku, ab, ipiv, BC);
+	return solveFactorisedBandedSystem(ab, ipiv, kl, ku, b, BC);
+}
+
+// *****************************************************************************
+///	\brief	LU factorise a banded matrix
+///
+///			The factors can be reused for any number of right-hand sides with
+///			solveFactorisedBandedSystem.
+///
+///	\param	A		A matrix in band storage (see solveBandedLinearSystem)
+///	\param	kl		number of sub-diagonals
+///	\param	ku		number of super-diagonals
+///	\param	ab		LU factors in LAPACK band storage
+///	\param	ipiv	pivot indices
+///	\param	BC		number of unknowns removed
+void GridUtils::factoriseBandedSystem(const std::vector<double> &A, int kl, int ku,
+	std::vector<double> &ab, std::vector<int> &ipiv, int BC) {
+
+	// Set up the correct values
+	int dim = static_cast<int>(A.size()) / (kl + ku + 1);
+	int row = dim - BC;
+	int LDA = kl + ku + 1;
+	int LDAB = 2 * kl + ku + 1;
+	int info;
+	ipiv.assign(row, 0);
+
+	// Copy reduced system into LAPACK layout leaving room for fill-in
+	ab.assign(LDAB * row, 0.0);
+	for (int j = 0; j < row; j++) {
+		for (int i = std::max(0, ku - j); i < std::min(LDA, row + ku - j); i++) {
+			ab[kl + i + j * LDAB] = A[i + (j + BC) * LDA];
+		}
+	}
+
+	// Factorise
+	dgbtrf_(&row, &row, &kl, &ku, ab.data(), &LDAB, ipiv.data(), &info);
+	if (info != 0)
+		L_ERROR("Banded LU factorisation failed with info = " + std::to_string(info) + ".", logfile);
+}
+
+// *****************************************************************************
+///	\brief	Solve a banded linear system already factorised
+///
+///	\param	ab		LU factors from factoriseBandedSystem
+///	\param	ipiv	pivot indices from factoriseBandedSystem
+///	\param	kl		number of sub-diagonals
+///	\param	ku		number of super-diagonals
+///	\param	b		b vector (RHS)
+///	\param	BC		number of unknowns removed
+///	\return	x
+std::vector<double> GridUtils::solveFactorisedBandedSystem(std::vector<double> &ab, std::vector<int> &ipiv,
+	int kl, int ku, std::vector<double> b, int BC) {
+
+	// Set up the correct values
+	char trans = 'N';
+	int row = static_cast<int>(b.size()) - BC;
+	int nrhs = 1;
+	int LDAB = 2 * kl + ku + 1;
+	int LDB = row;
+	int info;
+
+	// Solve
+	dgbtrs_(&trans, &row, &kl, &ku, &nrhs, ab.data(), &LDAB, ipiv.data(), b.data() + BC, &LDB, &info);
+
+	// Set return values not included to zero
+	fill(b.begin(), b.begin() + BC, 0.0);
+
+	// Return RHS
+	return b;
+}
+
+// *****************************************************************************
+///	\brief	Multiply a banded matrix by a vector
+///
+///	\param	A		A matrix in band storage (see solveBandedLinearSystem)
+///	\param	kl		number of sub-diagonals
+///	\param	ku		number of super-diagonals
+///	\param	x		x vector
+///	\return	A.x
+std::vector<double> GridUtils::bandMatrix_multiply(const std::vector<double> &A, int kl, int ku, const std::vector<double> &x) {
+
+	int dim = static_cast<int>(x.size());
+	int LDA = kl + ku + 1;
+	std::vector<double> b(dim, 0.0);
+
+	// Only the band of each row contributes
+	for (int i = 0; i < dim; i++) {
+		for (int j = std::max(0, i - kl); j <= std::min(dim - 1, i + ku); j++) {
+			b[i] += A[ku + i - j + j * LDA] * x[j];
+		}
+	}
+
+	return b;
+}
+
+// *****************************************************************************
+///	\brief	Solve the sparse linear system A.x = b iteratively
+///
+///			Uses BiCGSTAB with a Jacobi (diagonal) preconditioner so A need
+///			not be symmetric. A is supplied in compressed sparse row format and
+///			x is used as the initial guess.
+///
+///			For a system distributed across ranks each rank holds its own n 
+///			rows and x may be longer than b, with the extra entries being 
+///			ghost copies of unknowns owned elsewhere. The ghosts are refreshed
+///			by updateGhosts before each product with A and the dot products
+///			are completed by sumAcrossRanks.
+///
+///	\param	rowPtr			index of first entry of each row in colIdx/val (size n+1)
+///	\param	colIdx			column index of each entry
+///	\param	val				value of each entry
+///	\param	b				b vector (RHS)
+///	\param	x				initial guess on entry, solution on exit
+///	\param	tol				convergence tolerance on the residual relative to b
+///	\param	maxIter			maximum number of iterations
+///	\param	updateGhosts	fills in the ghost entries of a vector (may be empty)
+///	\param	sumAcrossRanks	sums an array of values over all ranks in place (may be empty)
+///	\return	number of iterations taken or -1 if not converged
+int GridUtils::solveSparseLinearSystem(const std::vector<int> &rowPtr, const std::vector<int> &colIdx,
+	const std::vector<double> &val, const std::vector<double> &b, std::vector<double> &x,
+	double tol, int maxIter, const std::function<void(std::vector<double>&)> &updateGhosts,
+	const std::function<void(double*, int)> &sumAcrossRanks) {
+
+	int n = static_cast<int>(b.size());
+	int nCols = static_cast<int>(x.size());
+
+	// Sparse matrix-vector product
+	auto multiply = [&](std::vector<double> &in, std::vector<double> &out) {
+		if (updateGhosts) updateGhosts(in);
+		for (int i = 0; i < n; i++) {
+			double sum = 0.0;
+			for (int e = rowPtr[i]; e < rowPtr[i + 1]; e++) sum += val[e] * in[colIdx[e]];
+			out[i] = sum;
+		}
+	};
+	auto dot = [&](const std::vector<double> &u, const std::vector<double> &v) {
+		double sum = 0.0;
+		for (int i = 0; i < n; i++) sum += u[i] * v[i];
+		if (sumAcrossRanks) sumAcrossRanks(&sum, 1);
+		return sum;
+	};
+
+	// Inverse of the diagonal for preconditioning
+	std::vector<double> invDiag(n, 1.0);
+	for (int i = 0; i < n; i++) {
+		for (int e = rowPtr[i]; e < rowPtr[i + 1]; e++) {
+			if (colIdx[e] == i && val[e] != 0.0) invDiag[i] = 1.0 / val[e];
+		}
+	}
+
+	// Initial residual
+	std::vector<double> r(n), rHat(n), p(n, 0.0), v(n, 0.0), y(nCols, 0.0), s(n), z(nCols, 0.0), t(n);
+	multiply(x, r);
+	for (int i = 0; i < n; i++) r[i] = b[i] - r[i];
+	rHat = r;
+
+	double bNorm = sqrt(dot(b, b));
+	if (bNorm == 0.0) bNorm = 1.0;
+	if (sqrt(dot(r, r)) < tol * bNorm) return 0;
+
+	double rho = 1.0, alpha = 1.0, omega = 1.0;
+	for (int it = 1; it <= maxIter; it++) {
+
+		double rhoNew = dot(rHat, r);
+		if (rhoNew == 0.0) return -1;
+
+		// Search direction
+		double beta = (rhoNew / rho) * (alpha / omega);
+		for (int i = 0; i < n; i++) {
+			p[i] = r[i] + beta * (p[i] - omega * v[i]);
+			y[i] = invDiag[i] * p[i];
+		}
+		multiply(y, v);
+		alpha = rhoNew / dot(rHat, v);
+
+		// Half step
+		for (int i = 0; i < n; i++) s[i] = r[i] - alpha * v[i];
+		if (sqrt(dot(s, s)) < tol * bNorm) {
+			for (int i = 0; i < n; i++) x[i] += alpha * y[i];
+			return it;
+		}
+
+		// Stabilising step
+		for (int i = 0; i < n; i++) z[i] = invDiag[i] * s[i];
+		multiply(z, t);
+		double tt = dot(t, t);
+		omega = (tt > 0.0) ? dot(t, s) / tt : 0.0;
+		for (int i = 0; i < n; i++) {
+			x[i] += alpha * y[i] + omega * z[i];
+			r[i] = s[i] - omega * t[i];
+		}
+		if (sqrt(dot(r, r)) < tol * bNorm) return it;
+		if (omega == 0.0) return -1;
+
+		rho = rhoNew;
+	}
+
+	return -1;
+}
+
+
+// *****************************************************************************
+///	\brief	Solve a small linear least-squares problem.
+///
+///			Minimises |A.x - b| by modified Gram-Schmidt QR. Columns which are 
+///			(nearly) linearly dependent on the earlier ones are dropped and 
+///			given a zero coefficient.
+///
+///	\param	cols	columns of A (all the same length as b)
+///	\param	b		b vector (RHS)
+///	\return	x vector (one coefficient per column)
+std::vector<double> GridUtils::solveLeastSquares(const std::vector<std::vector<double>> &cols, const std::vector<double> &b) {
+
+	size_t n = cols.size();
+	std::vector<std::vector<double>> Q;
+	std::vector<std::vector<double>> R(n, std::vector<double>(n, 0.0));
+	std::vector<int> kept;
+
+	// Orthogonalise the columns in turn
+	for (size_t c = 0; c < n; c++) {
+		std::vector<double> q = cols[c];
+		double origNorm = vecnorm(q);
+		std::vector<double> r(kept.size(), 0.0);
+		for (size_t j = 0; j < Q.size(); j++) {
+			r[j] = dotprod(Q[j], q);
+			for (size_t i = 0; i < q.size(); i++)
+				q[i] -= r[j] * Q[j][i];
+		}
+
+		// Drop if dependent on the earlier columns
+		double norm = vecnorm(q);
+		if (origNorm == 0.0 || norm < 1e-10 * origNorm) continue;
+		for (size_t i = 0; i < q.size(); i++)
+			q[i] /= norm;
+
+		// Store column of R for this kept column
+		size_t k = kept.size();
+		for (size_t j = 0; j < k; j++)
+			R[j][k] = r[j];
+		R[k][k] = norm;
+		Q.push_back(q);
+		kept.push_back(static_cast<int>(c));
+	}
+
+	// Back-substitute R.y = Q^T.b
+	size_t k = kept.size();
+	std::vector<double> y(k, 0.0);
+	for (int i = static_cast<int>(k) - 1; i >= 0; i--) {
+		double sum = dotprod(Q[i], b);
+		for (size_t j = i + 1; j < k; j++)
+			sum -= R[i][j] * y[j];
+		y[i] = sum / R[i][i];
+	}
+
+	// Map back to all columns
+	std::vector<double> x(n, 0.0);
+	for (size_t i = 0; i < k; i++)
+		x[kept[i]] = y[i];
+	return x;
+}
+
 // *****************************************************************************
 /// \brief	Gets the indices of the fine site given the coarse site.
 ///
@@ -506,9 +787,11 @@ double GridUtils::normaliseToLink(double value, int v)
 /// \brief	Finds out whether halo containing i,j,k links to neighbour rank periodically.
 ///
 ///			Checks the receiver layer containing local site i,j,k and determines 
-///			from the MPI topology information whether this layer couples to an 
-///			adjacent or periodic neighbour rank. I.e. if the neighbour is physically 
-///			next to the rank or whether it is actaully at the other side of the domain.
+///			from the block edges whether this layer couples to an adjacent or 
+///			periodic neighbour rank. I.e. if the neighbour is physically next to 
+///			the rank or whether it is actaully at the other side of the domain.
+///			A receiver layer is periodic if its position has been wrapped to 
+///			the opposite side of the core from the edge it sits on.
 ///
 /// \param	i	local i-index of recv layer site being queried.
 /// \param	j	local j-index of recv layer site being queried.
@@ -517,60 +800,25 @@ double GridUtils::normaliseToLink(double value, int v)
 /// \return	boolean answer.
 bool GridUtils::isOverlapPeriodic(int i, int j, int k, GridObj const & g) {
 
-	// Local declarations
-	int exp_rank_coords[L_DIMS], act_rank_coords[L_DIMS], dimensions[L_DIMS];
-	int shift[3] = {0, 0, 0};
-
 	// Get MpiManager instance
 	MpiManager *mpim = MpiManager::getInstance();
-
-	// Initialise local variables
-	dimensions[0] = L_MPI_XCORES;
-	dimensions[1] = L_MPI_YCORES;
-#if (L_DIMS == 3)
-	dimensions[2] = L_MPI_ZCORES;
-#endif
-
-	// Define shifts based on which overlap we are on
+	int rank = mpim->my_rank;
 
 	// X
-	if (GridUtils::isOnRecvLayer(g.XPos[i],eXMax)) {
-		shift[0] = 1;
-	} else if (GridUtils::isOnRecvLayer(g.XPos[i],eXMin)) {
-		shift[0] = -1;
-	}
+	if (GridUtils::isOnRecvLayer(g.XPos[i], eXMax) && g.XPos[i] < mpim->rank_core_edge[eXMin][rank]) return true;
+	if (GridUtils::isOnRecvLayer(g.XPos[i], eXMin) && g.XPos[i] > mpim->rank_core_edge[eXMax][rank]) return true;
 
 	// Y
-	if (GridUtils::isOnRecvLayer(g.YPos[j],eYMax)) {
-		shift[1] = 1;
-	} else if (GridUtils::isOnRecvLayer(g.YPos[j],eYMin)) {
-		shift[1] = -1;
-	}
+	if (GridUtils::isOnRecvLayer(g.YPos[j], eYMax) && g.YPos[j] < mpim->rank_core_edge[eYMin][rank]) return true;
+	if (GridUtils::isOnRecvLayer(g.YPos[j], eYMin) && g.YPos[j] > mpim->rank_core_edge[eYMax][rank]) return true;
 
 #if (L_DIMS == 3)
 	// Z
-	if (GridUtils::isOnRecvLayer(g.ZPos[k],eZMax)) {
-		shift[2] = 1;
-	} else if (GridUtils::isOnRecvLayer(g.ZPos[k],eZMin)) {
-		shift[2] = -1;
-	}
+	if (GridUtils::isOnRecvLayer(g.ZPos[k], eZMax) && g.ZPos[k] < mpim->rank_core_edge[eZMin][rank]) return true;
+	if (GridUtils::isOnRecvLayer(g.ZPos[k], eZMin) && g.ZPos[k] > mpim->rank_core_edge[eZMax][rank]) return true;
 #endif
 
-	// Loop over each Cartesian direction
-	for (int d = 0; d < L_DIMS; d++) {
-		// Define expected (non-periodic) MPI coordinates of neighbour rank
-		exp_rank_coords[d] = mpim->rank_coords[d] + shift[d];
-
-		// Define actual MPI coordinates of neighbour rank (accounting for periodicity)
-		act_rank_coords[d] = (mpim->rank_coords[d] + shift[d] + dimensions[d]) % dimensions[d];
-
-		// If there is a difference then rank is periodically linked to its neighbour and the overlap
-		// site is from a periodic rank so return early
-		if (exp_rank_coords[d] != act_rank_coords[d]) return true;
-	}
-	
-
-	// Expected and actual are the same so the neighbour rank is not periodically linked and the overlap site
+	// The neighbour rank is not periodically linked and the overlap site
 	// is from an adjacent neighbour not a periodic one.
 	return false;
 
@@ -1519,36 +1767,6 @@ bool GridUtils::isOffGrid(int i, int j, int k, GridObj const * const g) {
 	return false;
 }
 
-// ****************************************************************************
-/// \brief	Get direction in MPI topology from unit vector.
-///
-/// \param	offset_vector	unit vector pointing away from current rank.
-/// \return	MPI direction.
-int GridUtils::getMpiDirection(int offset_vector[])
-{
-
-	// Get Mpi Manager
-	MpiManager *mpim = MpiManager::getInstance();
-
-	// Loop over the directions
-	for (int d = 0; d < L_MPI_DIRS; ++d)
-	{
-		if (offset_vector[0] == mpim->neighbour_vectors[0][d] &&
-			offset_vector[1] == mpim->neighbour_vectors[1][d]
-
-#if (L_DIMS == 3)
-			&& offset_vector[2] == mpim->neighbour_vectors[2][d]
-#endif
-			)
-		{
-			return d;
-		}
-	}
-
-	return -1;
-
-}
-
 // ****************************************************************************
 /// \brief	Get local voxel indices on grid in which provided position lies.
 ///
@@ -1682,8 +1900,8 @@ void GridUtils::getEnclosingVoxel(double xyz, GridObj const * const g, eCartesia
 	else
 		offset = cellsGridStartToRankStart;
 
-	// If on L0, always add a halo offset of 1 for MPI builds
-	if (g->level == 0) offset = 1;
+	// If on L0, add a halo offset of 1 for MPI builds unless the block has no halo
+	if (g->level == 0) offset = mpim->has_halo[dir] ? 1 : 0;
 
 #endif // L_BUILD_FOR_MPI
 
@@ -152,8 +152,9 @@ void IBBody::sortPtCloudMarkers() {
 
 #else
 
-	// Parallel build is more tricky as owning rank needs to gather all markers, sort then scatter to other ranks
+	// Renumber the markers across all ranks, then the owning rank gathers them all in order
 	MpiManager *mpim = MpiManager::getInstance();
+	mpim->mpi_ptCloudMarkerSort(this);
 
 	// Declare vectors for MPI comms
 	std::vector<double> recvPositionBuffer;
@@ -164,30 +165,13 @@ void IBBody::sortPtCloudMarkers() {
 	// Gather in marker IDs and positions
 	mpim->mpi_ptCloudMarkerGather(this, recvPositionBuffer, recvIDBuffer, recvSizeBuffer, recvDisps);
 
-	// Now do the sorting
-	std::vector<int> sendSortedIDBuffer;
+	// Owning rank recreates the markers
 	if (mpim->my_rank == owningRank) {
 
-		// Create vector for each marker which contains rank ID and an index array
-		std::vector<int> rankIDs(recvIDBuffer.size(), 0);
+		// IDs are now consecutive so give the gathered index of each one directly
 		std::vector<int> indexIDs(recvIDBuffer.size(), 0);
-		int count = 0;
-		for (size_t i = 0; i < recvSizeBuffer.size(); i++) {
-			for (int j = 0; j < recvSizeBuffer[i]; j++) {
-				rankIDs[count] = static_cast<int>(i);
-				indexIDs[count] = count;
-				count++;
-			}
-		}
-
-		// Sort the IDs according to the current ID values and return the indices
-		std::sort(indexIDs.begin(), indexIDs.end(), [&](int a, int b) {return recvIDBuffer[a] < recvIDBuffer[b];});
-
-		// Pack into send buffer
-		sendSortedIDBuffer.resize(indexIDs.size(), 0);
-		for (size_t i = 0; i < indexIDs.size(); i++) {
-			sendSortedIDBuffer[indexIDs[i]] = static_cast<int>(i);
-		}
+		for (size_t i = 0; i < recvIDBuffer.size(); i++)
+			indexIDs[recvIDBuffer[i]] = static_cast<int>(i);
 
 		// First clear the markers
 		markers.clear();
@@ -205,10 +189,200 @@ void IBBody::sortPtCloudMarkers() {
 			addMarker(x, y, z, static_cast<int>(i));
 		}
 	}
+#endif
+}
 
-	// Gather in marker IDs and positions
-	mpim->mpi_ptCloudMarkerScatter(this, sendSortedIDBuffer, recvSizeBuffer, recvDisps);
+
+// *****************************************************************************
+///	\brief	Pack the support of the valid markers into contiguous arrays
+///
+///			Only support sites owned by this rank are stored, with their 
+///			flattened lattice index and delta value, so that interpolation and 
+///			spreading are simple gather/scatter loops. The entries are also 
+///			grouped by lattice site so that the force on each site can be 
+///			accumulated by a single thread in marker order. Must be called 
+///			whenever the support is found again.
+void IBBody::flattenSupport() {
+
+	// Get rank and grid sizes
+	int rank = GridUtils::safeGetRank();
+	int K_lim = _Owner->K_lim;
+	int M_lim = _Owner->M_lim;
+
+	// Arrays keep their capacity between calls
+	suppStart.resize(validMarkers.size() + 1);
+	suppSite.clear();
+	suppWeight.clear();
+	suppMarker.clear();
+
+	suppStart[0] = 0;
+	for (size_t v = 0; v < validMarkers.size(); v++) {
+		IBMarker &marker = markers[validMarkers[v]];
+		for (size_t s = 0; s < marker.deltaval.size(); s++) {
+			if (marker.support_rank[s] == rank) {
+				suppSite.push_back(marker.supp_k[s] + marker.supp_j[s] * K_lim + marker.supp_i[s] * K_lim * M_lim);
+				suppWeight.push_back(marker.deltaval[s]);
+				suppMarker.push_back(static_cast<int>(v));
+			}
+		}
+		suppStart[v + 1] = static_cast<int>(suppSite.size());
+	}
+
+	// Number the distinct sites in order of first appearance and count their entries
+	std::unordered_map<int, int> siteSlot;
+	std::vector<int> slotOfEntry(suppSite.size());
+	uniqueSite.clear();
+	uniqueStart.assign(1, 0);
+	for (size_t e = 0; e < suppSite.size(); e++) {
+		auto slot = siteSlot.insert(std::make_pair(suppSite[e], static_cast<int>(uniqueSite.size())));
+		if (slot.second) {
+			uniqueSite.push_back(suppSite[e]);
+			uniqueStart.push_back(0);
+		}
+		slotOfEntry[e] = slot.first->second;
+		uniqueStart[slot.first->second + 1]++;
+	}
+	for (size_t u = 0; u < uniqueSite.size(); u++)
+		uniqueStart[u + 1] += uniqueStart[u];
+
+	// Group the entries by site keeping them in marker order
+	std::vector<int> fill(uniqueStart.begin(), uniqueStart.end() - 1);
+	uniqueEntry.resize(suppSite.size());
+	for (size_t e = 0; e < suppSite.size(); e++)
+		uniqueEntry[fill[slotOfEntry[e]]++] = static_cast<int>(e);
+}
+
+
+// *****************************************************************************
+///	\brief	Check whether the support found last time is still valid
+///
+///			True if the valid markers on this rank are the same markers at 
+///			exactly the same positions as when the support was last found.
+///
+///	\return	true if the support does not need to be found again
+bool IBBody::isSupportCurrent() {
+
+	// Different set of markers
+	if (validMarkers.size() != supportCacheIDs.size())
+		return false;
+
+	// Check IDs and positions
+	for (size_t i = 0; i < validMarkers.size(); i++) {
+		if (markers[validMarkers[i]].id != supportCacheIDs[i])
+			return false;
+		for (int d = 0; d < L_DIMS; d++) {
+			if (markers[validMarkers[i]].position[d] != supportCachePositions[i * L_DIMS + d])
+				return false;
+		}
+	}
+	return true;
+}
+
+
+// *****************************************************************************
+///	\brief	Record the valid marker IDs and positions for which the support was found
+void IBBody::storeSupportCache() {
+
+	supportCacheIDs.resize(validMarkers.size());
+	supportCachePositions.resize(validMarkers.size() * L_DIMS);
+	for (size_t i = 0; i < validMarkers.size(); i++) {
+		supportCacheIDs[i] = markers[validMarkers[i]].id;
+		for (int d = 0; d < L_DIMS; d++)
+			supportCachePositions[i * L_DIMS + d] = markers[validMarkers[i]].position[d];
+	}
+}
+
+
+// *****************************************************************************
+///	\brief	Get the marker geometry relative to the lattice
+///
+///			Positions are taken relative to the lattice cell containing the 
+///			first marker so that a body translated by a whole number of lattice 
+///			spacings produces the same geometry. Dilation and area are appended.
+///
+///	\return	flattened marker geometry
+std::vector<double> IBBody::getMarkerGeometry() {
+
+	std::vector<double> geometry;
+	if (markers.size() == 0) return geometry;
+	geometry.reserve(markers.size() * (L_DIMS + 2));
+
+	// Lattice reference point
+	double ref[L_DIMS];
+	for (int d = 0; d < L_DIMS; d++)
+		ref[d] = dh * std::floor(markers[0].position[d] / dh);
+
+	for (size_t m = 0; m < markers.size(); m++) {
+		for (int d = 0; d < L_DIMS; d++)
+			geometry.push_back(markers[m].position[d] - ref[d]);
+		geometry.push_back(markers[m].dilation);
+		geometry.push_back(markers[m].local_area);
+	}
+	return geometry;
+}
+
+
+// *****************************************************************************
+///	\brief	Get the support geometry relative to the lattice
+///
+///			Uses the same reference point as IBBody::getMarkerGeometry so a 
+///			support which has been truncated differently (e.g. by a wall) is 
+///			never mistaken for a translated copy.
+///
+///	\return	flattened support geometry
+std::vector<double> IBBody::getSupportGeometry() {
+
+	std::vector<double> geometry;
+	if (markers.size() == 0) return geometry;
+
+	// Lattice reference point
+	double ref[L_DIMS];
+	for (int d = 0; d < L_DIMS; d++)
+		ref[d] = dh * std::floor(markers[0].position[d] / dh);
+
+	for (size_t m = 0; m < markers.size(); m++) {
+		geometry.push_back(static_cast<double>(markers[m].deltaval.size()));
+		for (size_t s = 0; s < markers[m].deltaval.size(); s++) {
+			geometry.push_back(markers[m].supp_x[s] - ref[eXDirection]);
+			geometry.push_back(markers[m].supp_y[s] - ref[eYDirection]);
+#if (L_DIMS == 3)
+			geometry.push_back(markers[m].supp_z[s] - ref[eZDirection]);
 #endif
+		}
+	}
+	return geometry;
+}
+
+
+// *****************************************************************************
+///	\brief	Find a cached geometry matching the current one
+///
+///	\param	markerGeometry		current marker geometry
+///	\param	supportGeometry		current support geometry (not compared if NULL)
+///	\return	index of the matching cache entry (-1 if none)
+int IBBody::findEpsilonCacheEntry(const std::vector<double> &markerGeometry, const std::vector<double> *supportGeometry) {
+
+	double tol = L_IBM_EPSILON_CACHE_TOL * dh;
+
+	// Search most recent first
+	for (int c = static_cast<int>(epsilonCache.size()) - 1; c >= 0; c--) {
+
+		const EpsilonCacheEntry &entry = epsilonCache[c];
+		if (entry.markerGeometry.size() != markerGeometry.size()) continue;
+		if (supportGeometry && entry.supportGeometry.size() != supportGeometry->size()) continue;
+
+		bool bMatch = true;
+		for (size_t i = 0; i < markerGeometry.size() && bMatch; i++) {
+			if (fabs(entry.markerGeometry[i] - markerGeometry[i]) > tol) bMatch = false;
+		}
+		if (supportGeometry) {
+			for (size_t i = 0; i < supportGeometry->size() && bMatch; i++) {
+				if (fabs(entry.supportGeometry[i] - (*supportGeometry)[i]) > tol) bMatch = false;
+			}
+		}
+		if (bMatch) return c;
+	}
+	return -1;
 }
 
 
@@ -260,7 +434,7 @@ IBBody::IBBody(GridObj* g, int bodyID, PCpts* _PCpts, eMoveableType moveProperty
 ///	\param 	E					Young's modulus
 IBBody::IBBody(GridObj* g, int bodyID, std::vector<double> &start_position,
 		double length, double height, double depth, std::vector<double> &angles, eMoveableType moveProperty, int nElements, bool clamped, double density, double E)
-		: Body(g, bodyID, start_position, length, angles)
+		: Body(g, bodyID, start_position, length, angles, (moveProperty == eFlexible) ? static_cast<double>(nElements) : 0.0)
 {
 
 	// IBM-specific initialisation
@@ -137,3 +137,63 @@ SupportCommMarkerSideClass::SupportCommMarkerSideClass(int rankID, int body, int
 	supportID = support;
 	rankComm = rankID;
 }
+
+
+
+// *********************** Neighbour List Methods ******************************
+
+// *****************************************************************************
+///	\brief	Default constructor for IBM comm neighbour list
+IBCommNeighbourList::IBCommNeighbourList() {
+
+	// Start with a single zero displacement
+	displs.push_back(0);
+}
+
+
+// *****************************************************************************
+///	\brief	Build neighbour list from the comm entries
+///
+///			Entries keep their relative order within each neighbour's block so
+///			that packing and unpacking in entry order matches on both sides.
+///
+///	\param	entryRank	rank to communicate with for each comm entry
+///	\param	entrySize	number of buffer elements (per unit stride) of each comm entry
+void IBCommNeighbourList::build(const std::vector<int> &entryRank, const std::vector<int> &entrySize) {
+
+	// Get sorted unique ranks
+	ranks = entryRank;
+	std::sort(ranks.begin(), ranks.end());
+	ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+
+	// Count size of each block
+	std::vector<int> count(ranks.size() + 1, 0);
+	std::vector<int> entryNbr(entryRank.size(), 0);
+	for (size_t i = 0; i < entryRank.size(); i++) {
+		entryNbr[i] = static_cast<int>(std::lower_bound(ranks.begin(), ranks.end(), entryRank[i]) - ranks.begin());
+		count[entryNbr[i] + 1] += entrySize[i];
+	}
+
+	// Block displacements
+	displs.assign(ranks.size() + 1, 0);
+	for (size_t n = 0; n < ranks.size(); n++)
+		displs[n + 1] = displs[n] + count[n + 1];
+
+	// Entry displacements
+	std::vector<int> fill(displs.begin(), displs.end() - 1);
+	entryDispl.resize(entryRank.size());
+	for (size_t i = 0; i < entryRank.size(); i++) {
+		entryDispl[i] = fill[entryNbr[i]];
+		fill[entryNbr[i]] += entrySize[i];
+	}
+}
+
+
+// *****************************************************************************
+///	\brief	Empty the neighbour list
+void IBCommNeighbourList::clear() {
+
+	ranks.clear();
+	displs.assign(1, 0);
+	entryDispl.clear();
+}
@@ -26,14 +26,6 @@
 // Static declarations
 MpiManager* MpiManager::me;
 
-// Although I don't want this to be static VC++ 2013 doesn't support constructor initialiser lists
-const int MpiManager::neighbour_vectors[3][26] = 
-{
-	{ 1, -1, 1, -1, 0, 0, -1, 1, 0, 0, 1, -1, 1, -1, 0, 0, -1, 1, -1, 1, -1, 1, 0, 0, 1, -1 },
-	{ 0, 0, 1, -1, 1, -1, 1, -1, 0, 0, 0, 0, 1, -1, 1, -1, 1, -1, 0, 0, -1, 1, -1, 1, -1, 1 },
-	{ 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1 }
-};
-
 // ****************************************************************************
 /// Default constructor
 MpiManager::MpiManager()
@@ -50,9 +42,9 @@ MpiManager::MpiManager()
 
 #endif
 
-	// Resize buffer arrays based on number of MPI directions
-	f_buffer_send.resize(L_MPI_DIRS, std::vector<double>(0));
-	f_buffer_recv.resize(L_MPI_DIRS, std::vector<double>(0));	
+	// Reset communication timers
+	comm_time = 0.0;
+	comm_time_accum = 0.0;
 
 	// Initialise the manager, grid information and topology
 	mpi_init();
@@ -62,6 +54,12 @@ MpiManager::MpiManager()
 	markerCommMarkerSide.resize(L_NUM_LEVELS+1);
 	supportCommMarkerSide.resize(L_NUM_LEVELS+1);
 	supportCommSupportSide.resize(L_NUM_LEVELS+1);
+	markerNbrOwnerSide.resize(L_NUM_LEVELS+1);
+	markerNbrMarkerSide.resize(L_NUM_LEVELS+1);
+	markerSuppNbrOwnerSide.resize(L_NUM_LEVELS+1);
+	markerSuppNbrMarkerSide.resize(L_NUM_LEVELS+1);
+	supportNbrMarkerSide.resize(L_NUM_LEVELS+1);
+	supportNbrSupportSide.resize(L_NUM_LEVELS+1);
 }
 
 /// \brief	Default destructor.
@@ -76,6 +74,9 @@ MpiManager::~MpiManager(void)
 		logout->close();
 		delete logout;
 	}
+
+	// Release the token communicator
+	MPI_Comm_free(&token_comm);
 }
 
 /// Instance creator
@@ -103,24 +104,49 @@ void MpiManager::destroyInstance() {
 void MpiManager::mpi_init()
 {
 
+#ifdef L_MPI_RCB_DECOMPOSE
+	// Blocks are not arranged on a grid so no Cartesian topology is used
+	dimensions[0] = 0;
+	dimensions[1] = 0;
+	dimensions[2] = 0;
+	MPI_Comm_dup(MPI_COMM_WORLD, &world_comm);
+#else
 	// Create communicator and topology
 	int MPI_periodic[3], MPI_reorder;
 	MPI_reorder = true;
+#ifdef L_MPI_AUTO_TOPOLOGY
+	// Let MPI choose a balanced topology for the number of ranks launched
+	int launched_ranks;
+	MPI_Comm_size(MPI_COMM_WORLD, &launched_ranks);
+	dimensions[0] = 0;
+	dimensions[1] = 0;
+	dimensions[2] = 1;
+	MPI_Dims_create(launched_ranks, L_DIMS, &dimensions[0]);
+#else
 	dimensions[0] = L_MPI_XCORES;
 	dimensions[1] = L_MPI_YCORES;
 	dimensions[2] = L_MPI_ZCORES;
+#endif
 	MPI_periodic[0] = true;
 	MPI_periodic[1] = true;
 	MPI_periodic[2] = true;
 
 	MPI_Cart_create(MPI_COMM_WORLD, L_DIMS, &dimensions[0], &MPI_periodic[0], MPI_reorder, &world_comm);
+#endif
+
+	// Separate context for ordering tokens so they can never match halo or IBM messages
+	MPI_Comm_dup(world_comm, &token_comm);
 
 	// Get Cartesian topology info
 	MPI_Comm_rank(world_comm, &my_rank);
 	MPI_Comm_size(world_comm, &num_ranks);
 
 	// Store coordinates in the new topology
+#ifdef L_MPI_RCB_DECOMPOSE
+	for (int d = 0; d < L_DIMS; d++) rank_coords[d] = 0;
+#else
 	MPI_Cart_coords(world_comm, my_rank, L_DIMS, rank_coords);
+#endif
 
 	// Output directory creation (only master rank)
 	if (my_rank == 0) GridUtils::createOutputDirectory(GridUtils::path_str);
@@ -149,6 +175,7 @@ void MpiManager::mpi_init()
 	// State my rank
 	L_INFO("My rank is " + std::to_string(my_rank) + ". There are " + std::to_string(num_ranks) + " ranks.", logout);
 
+#ifndef L_MPI_RCB_DECOMPOSE
 	// Write out coordinates to application log
 	std::string msg("Coordinates on rank " + std::to_string(my_rank) + " are (");
 	for (size_t d = 0; d < L_DIMS; d++) {
@@ -157,39 +184,12 @@ void MpiManager::mpi_init()
 	msg += "\t)";
 	L_INFO(msg, logout);
 #endif
-
-
-	// Get neighbour ID //
-
-	// Loop over grid direction
-	for (int dir = 0; dir < L_MPI_DIRS; dir++) {
-
-		MPI_Barrier(world_comm);
-
-		// Get coordinates of neighbour (taking into account periodic structure)
-		int coord_tmp[L_DIMS];
-		for (size_t d = 0; d < L_DIMS; d++) {
-			neighbour_coords[d][dir] = (rank_coords[d] + neighbour_vectors[d][dir] + dimensions[d]) % dimensions[d];
-			coord_tmp[d] = neighbour_coords[d][dir];	// Store single vector for getting neighbour rank
-		}
-
-		// Get rank of neighbour and build vector of neighbour ranks
-		int tmp;
-		MPI_Cart_rank(world_comm, coord_tmp, &tmp);
-		neighbour_rank[dir] = tmp;
-
-		MPI_Barrier(world_comm);
-
-#ifdef L_MPI_VERBOSE
-		// Print out current neighbour coordinates and rank
-		*logout << "Neighbour in direction " << dir << " of rank " << my_rank << " is (";
-		for (size_t d = 0; d < L_DIMS; d++) {
-			*logout << "\t" << neighbour_coords[d][dir];
-		}
-		*logout << "\t): Rank " << neighbour_rank[dir] << std::endl;
 #endif
 
-	}
+	/* Neighbours are not fixed by the topology. They are found from the 
+	 * block edges once the domain has been decomposed and each grid built 
+	 * (see mpi_buffer_size()). */
+
 
 	// End Initialisation //
 
@@ -217,8 +217,16 @@ void MpiManager::mpi_gridbuild(GridManager* const grid_man)
 	numCells[1] = L_M;
 	numCells[2] = L_K;
 
+#if (defined L_MPI_TOPOLOGY_REPORT || defined L_MPI_SMART_DECOMPOSE || defined L_MPI_RCB_DECOMPOSE)
+	// Estimate the load of any bodies for the decomposition cost model
+	grid_man->estimateBodyLoads();
+#endif
+
 	// Compute block sizes based on chosen algorithm
-#ifdef L_MPI_TOPOLOGY_REPORT
+#ifdef L_MPI_RCB_DECOMPOSE
+	L_INFO("Using Recursive Bisection Decomposition...", GridUtils::logfile);
+	mpi_rcbDecompose();
+#elif defined L_MPI_TOPOLOGY_REPORT
 	mpi_reportOnDecomposition(dh);
 #elif defined L_MPI_SMART_DECOMPOSE
 	// Log use of SD
@@ -240,13 +248,42 @@ void MpiManager::mpi_gridbuild(GridManager* const grid_man)
 	L_INFO(msg, logout); msg.clear();
 #endif
 
+	// Build the local grid sizes, core edges and halo positions from the rank sizes
+	mpi_updateBlockEdges(grid_man);
+
+}
+
+// ************************************************************************* //
+/// \brief	Set local grid size, rank core edges and halo positions.
+///
+///			Uses the rank size arrays populated by the decomposition to set the
+///			local coarse grid size in the grid manager, the core edges of every 
+///			rank and the sender and receiver layer positions of this rank. 
+///			Called at start up and again whenever the domain is redecomposed.
+///
+///	\param	grid_man	Pointer to an initialised grid manager.
+void MpiManager::mpi_updateBlockEdges(GridManager* const grid_man)
+{
+	double dh = L_COARSE_SITE_WIDTH;
+
 	// Compute required local grid size to pass to grid manager //
 	std::vector<int> local_size;
 
+	/* A block only has a halo in a given direction if it does not span the 
+	 * whole domain in that direction. For a Cartesian topology this is the 
+	 * case when there is only one rank in that direction. */
+	has_halo[eXDirection] = cRankSizeX[my_rank] < grid_man->global_size[eXDirection][0];
+	has_halo[eYDirection] = cRankSizeY[my_rank] < grid_man->global_size[eYDirection][0];
+#if (L_DIMS == 3)
+	has_halo[eZDirection] = cRankSizeZ[my_rank] < grid_man->global_size[eZDirection][0];
+#else
+	has_halo[eZDirection] = false;
+#endif
+
 	// Loop over dimensions
 	for (size_t d = 0; d < L_DIMS; d++)
 	{
-		if (dimensions[d] == 1)
+		if (!has_halo[d])
 		{
 			// If only 1 rank in this direction local grid is same size a global grid (no halo)
 			local_size.push_back(grid_man->global_size[d][0]);
@@ -285,6 +322,23 @@ void MpiManager::mpi_gridbuild(GridManager* const grid_man)
 
 	if (my_rank == 0)
 	{
+#ifdef L_MPI_RCB_DECOMPOSE
+		// Blocks store their own starting index so edges follow directly
+		for (int rank = 0; rank < num_ranks; rank++)
+		{
+			rank_core_edge[eXMin][rank] = cRankStartX[rank] * dh;
+			rank_core_edge[eXMax][rank] = rank_core_edge[eXMin][rank] + (cRankSizeX[rank] * dh);
+			rank_core_edge[eYMin][rank] = cRankStartY[rank] * dh;
+			rank_core_edge[eYMax][rank] = rank_core_edge[eYMin][rank] + (cRankSizeY[rank] * dh);
+#if (L_DIMS == 3)
+			rank_core_edge[eZMin][rank] = cRankStartZ[rank] * dh;
+			rank_core_edge[eZMax][rank] = rank_core_edge[eZMin][rank] + (cRankSizeZ[rank] * dh);
+#else
+			rank_core_edge[eZMin][rank] = 0.0;
+			rank_core_edge[eZMax][rank] = grid_man->global_edges[eZMax][0];
+#endif
+		}
+#else
 		// Variables
 		int currentRank;
 		int prevRank;
@@ -341,6 +395,7 @@ void MpiManager::mpi_gridbuild(GridManager* const grid_man)
 				}
 			}
 		}
+#endif
 
 	}
 
@@ -373,7 +428,7 @@ void MpiManager::mpi_gridbuild(GridManager* const grid_man)
 	 * used by LUMA, i.e. < 0.0. */
 
 	// X
-	if (dimensions[eXDirection] == 1)
+	if (!has_halo[eXDirection])
 	{
 		sender_layer_pos.X[eLeftMin] = -1.0;
 		sender_layer_pos.X[eLeftMax] = -1.0;
@@ -415,7 +470,7 @@ void MpiManager::mpi_gridbuild(GridManager* const grid_man)
 	}
 
 	// Y
-	if (dimensions[eYDirection] == 1)
+	if (!has_halo[eYDirection])
 	{
 		sender_layer_pos.Y[eLeftMin] = -1.0;
 		sender_layer_pos.Y[eLeftMax] = -1.0;
@@ -456,7 +511,7 @@ void MpiManager::mpi_gridbuild(GridManager* const grid_man)
 
 	// Z
 #if (L_DIMS == 3)
-	if (dimensions[eZDirection] == 1)
+	if (!has_halo[eZDirection])
 	{
 		sender_layer_pos.Z[eLeftMin] = -1.0;
 		sender_layer_pos.Z[eLeftMax] = -1.0;
@@ -497,12 +552,12 @@ void MpiManager::mpi_gridbuild(GridManager* const grid_man)
 #endif
 
 #ifdef L_MPI_VERBOSE
-	if (dimensions[eXDirection] == 1 || dimensions[eYDirection] == 1
+	if (!has_halo[eXDirection] || !has_halo[eYDirection]
 #if (L_DIMS == 3)
-		|| dimensions[eZDirection] == 1
+		|| !has_halo[eZDirection]
 #endif
 		)
-		L_WARN("One of the MPI dimensions is 1 so sender and receiver layers in this direction will be set to -1 as they have no meaning in this context.", logout);
+		L_WARN("Block spans the whole domain in one direction so sender and receiver layers in this direction will be set to -1 as they have no meaning in this context.", logout);
 
 	L_INFO("X sender layers are: " +
 		std::to_string(sender_layer_pos.X[eLeftMin]) + " -- " + std::to_string(sender_layer_pos.X[eLeftMax]) + " (min edge) , " +
@@ -578,19 +633,22 @@ void MpiManager::mpi_communicateBlockEdges()
 ///
 ///			When verbose MPI logging is turned on this method will write out 
 ///			the communication buffer to an ASCII file.
-void MpiManager::mpi_writeout_buf( std::string filename, int dir ) {
+///
+/// \param	filename	name of the file to write.
+/// \param	n			index of the neighbour whose buffers are written.
+void MpiManager::mpi_writeout_buf( std::string filename, int n ) {
 
 	std::ofstream rankout;
 	rankout.open(filename.c_str(), std::ios::out);
 
-	rankout << "f_buffer_send is of size " << f_buffer_send[dir].size() << " with values: " << std::endl;
-	for (size_t v = 0; v < f_buffer_send[dir].size(); v++) {
-		rankout << f_buffer_send[dir][v] << std::endl;
+	rankout << "f_buffer_send is of size " << f_buffer_send[n].size() << " with values: " << std::endl;
+	for (size_t v = 0; v < f_buffer_send[n].size(); v++) {
+		rankout << f_buffer_send[n][v] << std::endl;
 	}
 
-	rankout << "f_buffer_recv is of size " << f_buffer_recv[dir].size() << " with values: " << std::endl;
-	for (size_t v = 0; v < f_buffer_recv[dir].size(); v++) {
-		rankout << f_buffer_recv[dir][v] << std::endl;
+	rankout << "f_buffer_recv is of size " << f_buffer_recv[n].size() << " with values: " << std::endl;
+	for (size_t v = 0; v < f_buffer_recv[n].size(); v++) {
+		rankout << f_buffer_recv[n][v] << std::endl;
 	}
 
 	rankout.close();
@@ -610,12 +668,32 @@ void MpiManager::mpi_writeout_buf( std::string filename, int dir ) {
 /// \param	reg	region number of grid to communicate.
 void MpiManager::mpi_communicate(int lev, int reg) {
 
-	// Wall clock variables
-	clock_t t_start, t_end, secs;
+	// Exchange and then unpack
+	mpi_communicateBegin(lev, reg, false);
+	mpi_communicateEnd(lev, reg);
+
+}
+
+// ************************************************************************* //
+/// \brief	First half of the communication routine.
+///
+///			Packs and sends the sender layers and receives the neighbour 
+///			halos into the receive buffers without unpacking them. When called 
+///			from inside the LBM kernel before the distributions have been 
+///			swapped, the sender layers are packed from the post-collision 
+///			store (fNew). Must be followed by mpi_communicateEnd().
+///
+/// \param	lev			level of grid to communicate.
+/// \param	reg			region number of grid to communicate.
+/// \param	packNew		pack from fNew rather than f.
+void MpiManager::mpi_communicateBegin(int lev, int reg, bool packNew) {
+
+	// Wall clock variable
+	double t_start;
 
 	// Tag
 	int TAG;
-	int send_count = 0;
+	send_count = 0;
 
 	// Get grid object
 	GridObj* Grid = NULL;
@@ -637,51 +715,58 @@ void MpiManager::mpi_communicate(int lev, int reg) {
 	* will be out of sync. Need to allow the blocking nature of the send and receive calls to force correct 
 	* synchronisation between processes and only call barriers outside the grid scope.
 	*
-	* For each sending direction, pack and load a message into the message queue 
-	* for the destination rank with tag associated with direction.
-	* Then for each receive direction, pull message with correct tag from the queue 
-	* and unpack.
+	* For each neighbour in the list for this grid, pack and load a message into the 
+	* message queue for the destination rank with tag associated with the grid.
+	* Then for each neighbour, pull message with correct tag from the queue 
+	* and unpack. As a pair of ranks exchange at most one message per grid, the 
+	* tag does not need to identify a direction.
 	*
 	* In order to do this, need non-blocking send and receive calls and each needs
 	* their own buffer to store the information which cannot be touched until the 
 	* send is completed, hence this implementation carries a bigger memeory requirement
-	* as buffer reuse through the direction loop is not possible.
+	* as buffer reuse through the neighbour loop is not possible.
 	* Although MPI_Bsend() will do something similar it relies on creating and filling 
 	* MPI background buffers which might have limited resources and which is slower so 
 	* we use the MPI Manager class to hold the buffer in house. */
 
 	// Start the clock
-	t_start = clock();
+	t_start = MPI_Wtime();
 
-	// Loop over directions in Cartesian topology
-	for (int dir = 0; dir < L_MPI_DIRS; dir++)
-	{
+	// Find the neighbour list for this grid
+	const HaloExchangeStruct *halo = nullptr;
+	for (const HaloExchangeStruct& h : halo_info) {
+		if (h.level == Grid->level && h.region == Grid->region_number) halo = &h;
+	}
+	if (halo == nullptr) L_ERROR("No neighbour list found for L" + std::to_string(lev) + "R" + std::to_string(reg) + ". Exiting.", GridUtils::logfile);
 
-		/* Create a unique tag based on level (< 32), region (< 10) and direction (< 100).
-		 * MPICH limits state that tag value cannot be greater than 32767 */
-		TAG = ((Grid->level + 1) * 1000) + ((Grid->region_number + 1) * 100) + dir;
+	/* Create a unique tag based on level (< 32) and region (< 10).
+	 * MPICH limits state that tag value cannot be greater than 32767 */
+	TAG = ((Grid->level + 1) * 1000) + ((Grid->region_number + 1) * 100);
 
 #ifdef L_MPI_VERBOSE
-		*logout << "Processing Message with Tag --> " << TAG << std::endl;
+	*logout << "Processing Message with Tag --> " << TAG << std::endl;
 #endif
 
+	// Size the buffers for the neighbours of this grid
+	size_t numNeighbours = halo->neighbours.size();
+	if (f_buffer_send.size() < numNeighbours) f_buffer_send.resize(numNeighbours);
+	if (f_buffer_recv.size() < numNeighbours) f_buffer_recv.resize(numNeighbours);
+	if (send_requests.size() < numNeighbours) send_requests.resize(numNeighbours);
+
+	// Pack and post a send to each neighbour
+	for (size_t n = 0; n < numNeighbours; n++)
+	{
 		////////////////////////////
 		// Resize and Pack Buffer //
 		////////////////////////////
 
-		// Adjust buffer size
-		for (MpiManager::BufferSizeStruct bufs : buffer_send_info) {
-			if (bufs.level == Grid->level && bufs.region == Grid->region_number) {
-				f_buffer_send[dir].resize(bufs.size[dir] * L_NUM_VELS);
-			}
-		}
+		f_buffer_send[n].resize(halo->send_sites[n].size() * L_NUM_VELS);
 
 		// Only pack and send if required
-		if (f_buffer_send[dir].size()) {
+		if (f_buffer_send[n].size()) {
+
+			mpi_buffer_pack(static_cast<int>(n), *halo, Grid, packNew);
 
-			// Pass direction and Grid by reference and pack if required
-			mpi_buffer_pack( dir, Grid );
-		
 
 			///////////////
 			// Post Send //
@@ -690,71 +775,89 @@ void MpiManager::mpi_communicate(int lev, int reg) {
 			send_count++;
 
 #ifdef L_MPI_VERBOSE
-			*logout << "L" << Grid->level << "R" << Grid->region_number << " -- Direction " << dir 
-								<< " -->  Posting Send for " << f_buffer_send[dir].size() / L_NUM_VELS
-								<< " sites to Rank " << neighbour_rank[dir] << " with tag " << TAG << "." << std::endl;
+			*logout << "L" << Grid->level << "R" << Grid->region_number
+								<< " -->  Posting Send for " << f_buffer_send[n].size() / L_NUM_VELS
+								<< " sites to Rank " << halo->neighbours[n] << " with tag " << TAG << "." << std::endl;
 #endif
 			// Post send message to message queue and log request handle in array
-			MPI_Isend( &f_buffer_send[dir].front(), static_cast<int>(f_buffer_send[dir].size()), MPI_DOUBLE, neighbour_rank[dir], 
+			MPI_Isend( &f_buffer_send[n].front(), static_cast<int>(f_buffer_send[n].size()), MPI_DOUBLE, halo->neighbours[n], 
 				TAG, world_comm, &send_requests[send_count-1] );
 
-#ifdef L_MPI_VERBOSE
-			*logout << "Direction " << dir << " --> Send Posted." << std::endl;
-#endif
-
 		}
+	}
 
-		// Find opposite direction (neighbour it receives from)
-		int opp_dir = mpi_getOpposite(dir);
-		
-		// Resize the receive buffer
-		for (MpiManager::BufferSizeStruct bufr : buffer_recv_info) {
-			if (bufr.level == Grid->level && bufr.region == Grid->region_number) {
-				f_buffer_recv[dir].resize(bufr.size[dir] * L_NUM_VELS);
-			}
-		}
+	// Receive from each neighbour
+	for (size_t n = 0; n < numNeighbours; n++)
+	{
+		f_buffer_recv[n].resize(halo->recv_sites[n].size() * L_NUM_VELS);
 
 
 		///////////////////
 		// Fetch Message //
 		///////////////////
 
-		if (f_buffer_recv[dir].size()) {
+		if (f_buffer_recv[n].size()) {
 
 #ifdef L_MPI_VERBOSE
-			*logout << "L" << Grid->level << "R" << Grid->region_number << " -- Direction " << dir 
-								<< " -->  Fetching message for " << f_buffer_recv[dir].size() / L_NUM_VELS	
-								<< " sites from Rank " << neighbour_rank[opp_dir] << " with tag " << TAG << "." << std::endl;
+			*logout << "L" << Grid->level << "R" << Grid->region_number
+								<< " -->  Fetching message for " << f_buffer_recv[n].size() / L_NUM_VELS	
+								<< " sites from Rank " << halo->neighbours[n] << " with tag " << TAG << "." << std::endl;
 #endif
 
 			// Use a blocking receive call if required
-			MPI_Recv( &f_buffer_recv[dir].front(), static_cast<int>(f_buffer_recv[dir].size()), MPI_DOUBLE, neighbour_rank[opp_dir], 
+			MPI_Recv( &f_buffer_recv[n].front(), static_cast<int>(f_buffer_recv[n].size()), MPI_DOUBLE, halo->neighbours[n], 
 				TAG, world_comm, &recv_stat );
 
+		}
+
 #ifdef L_MPI_VERBOSE
-			*logout << "Direction " << dir << " --> Received." << std::endl;
+
+		*logout << "SUMMARY for L" << Grid->level << "R" << Grid->region_number
+			<< " -- Sent " << f_buffer_send[n].size() / L_NUM_VELS << " to " << halo->neighbours[n]
+			<< ": Received " << f_buffer_recv[n].size() / L_NUM_VELS << " from " << halo->neighbours[n] << std::endl;
+
+		// Write out buffers
+		std::string filename = GridUtils::path_str + "/mpiBuffer_Rank" + std::to_string(my_rank) + "_Nbr" + std::to_string(halo->neighbours[n]) + ".out";
+		mpi_writeout_buf(filename, static_cast<int>(n));
 #endif
 
-			///////////////////////////
-			// Unpack Buffer to Grid //
-			///////////////////////////
+	}
+
+	// Record time spent in the exchange
+	comm_time = MPI_Wtime() - t_start;
 
-			// Pass direction and Grid by reference
-			mpi_buffer_unpack( dir, Grid );
+}
 
-		}
+// ************************************************************************* //
+/// \brief	Second half of the communication routine.
+///
+///			Unpacks the receive buffers filled by mpi_communicateBegin() into 
+///			the receiver layers of the grid, waits for the sends to complete 
+///			and updates the MPI overhead timer.
+///
+/// \param	lev	level of grid to communicate.
+/// \param	reg	region number of grid to communicate.
+void MpiManager::mpi_communicateEnd(int lev, int reg) {
 
-#ifdef L_MPI_VERBOSE
+	// Start the clock
+	double t_start = MPI_Wtime();
 
-		*logout << "SUMMARY for L" << Grid->level << "R" << Grid->region_number << " -- Direction " << dir
-			<< " -- Sent " << f_buffer_send[dir].size() / L_NUM_VELS << " to " << neighbour_rank[dir]
-			<< ": Received " << f_buffer_recv[dir].size() / L_NUM_VELS << " from " << neighbour_rank[opp_dir] << std::endl;
+	// Get grid object
+	GridObj* Grid = NULL;
+	GridUtils::getGrid(GridManager::getInstance()->Grids, lev, reg,  Grid);
 
-		// Write out buffers
-		std::string filename = GridUtils::path_str + "/mpiBuffer_Rank" + std::to_string(my_rank) + "_Dir" + std::to_string(dir) + ".out";
-		mpi_writeout_buf(filename, dir);
-#endif
+	///////////////////////////
+	// Unpack Buffer to Grid //
+	///////////////////////////
 
+	for (const HaloExchangeStruct& halo : halo_info)
+	{
+		if (halo.level != lev || halo.region != reg) continue;
+
+		for (size_t n = 0; n < halo.neighbours.size(); n++)
+		{
+			if (halo.recv_sites[n].size()) mpi_buffer_unpack( static_cast<int>(n), halo, Grid );
+		}
 	}
 
 #ifdef L_MPI_VERBOSE
@@ -766,16 +869,16 @@ void MpiManager::mpi_communicate(int lev, int reg) {
 	/* Wait until other processes have handled all the sends from this rank
 	 * Note that calls to this command destroy the handles once complete so
 	 * do not need to clear the array afterward. */
-	MPI_Waitall(send_count,send_requests,send_stat);
+	if (send_count) MPI_Waitall(send_count, &send_requests[0], MPI_STATUSES_IGNORE);
 
 
-	// Print Time of MPI comms
-	t_end = clock();
-	secs = t_end - t_start;
+	// Time of MPI comms
+	comm_time += MPI_Wtime() - t_start;
+	comm_time_accum += comm_time;
 
 	// Update average MPI overhead time for this particular grid
 	Grid->timeav_mpi_overhead *= (Grid->t-1);
-	Grid->timeav_mpi_overhead += ((double)secs)/CLOCKS_PER_SEC;
+	Grid->timeav_mpi_overhead += comm_time;
 	Grid->timeav_mpi_overhead /= Grid->t;
 
 #ifdef L_TEXTOUT
@@ -795,202 +898,198 @@ void MpiManager::mpi_communicate(int lev, int reg) {
 }
 
 // ************************************************************************* //
-/// \brief	Pre-calcualtion of the buffer sizes.
+/// \brief	Pre-calculation of the neighbour lists.
 ///
-///			Wrapper method for computing the buffer sizes for every grid on the
-///			rank, both sender and receiver. Must be called post-initialisation.
+///			Builds the list of sites exchanged with each neighbouring rank for
+///			every grid on the rank. Must be called post-initialisation by all
+///			ranks. Neighbours are found from the block edges rather than from a
+///			fixed topology so any decomposition into boxes is supported.
+///
+///			Each rank finds the owner of every site in its receiver layer and 
+///			sends it the global index of the site. The owner then converts 
+///			these to local indices which become its send list. As both sides 
+///			keep the order in which the indices were sent, no further 
+///			information is needed to pack and unpack the buffers.
 void MpiManager::mpi_buffer_size() {
 
-	*GridUtils::logfile << "Pre-computing buffer sizes for MPI...";
+	*GridUtils::logfile << "Building neighbour lists for MPI...";
 
-	/* For each grid in the hierarchy find communicating edges and store the buffer size.
-	 * The data are arranged:
-	 *
-	 *		BufSize[direction][level][region]
-	 *
-	 * where direction is identified by the MPI labelling at the top of this file.
-	 * A zero buffer size indicates that this edge does not communicate with a neighbour rank. */
+	// Discard any existing lists
+	halo_info.clear();
+
+	GridManager *gm = GridManager::getInstance();
+	std::vector< std::vector<long long> > requestKeys(num_ranks);
+	std::vector< std::vector<int> > recvIds(num_ranks);
+	std::vector<int> sendCounts(num_ranks), recvCounts(num_ranks);
+	std::vector<int> sendDispls(num_ranks), recvDispls(num_ranks);
+	std::vector<long long> sendKeys, recvKeys;
+	std::vector<double> position(3, 0.0);
+	std::vector<int> ijk;
 
-	// Loop through levels and regions
+	// Loop through levels and regions (every rank takes part for every grid)
 	GridObj* g;	// Pointer to a GridObj
 	for (int l = 0; l <= L_NUM_LEVELS; l++) {
 		for (int r = 0; r < L_NUM_REGIONS; r++) {
 
+			// L0 can only be R0
+			if (l == 0 && r != 0) continue;
+
 			// Null the pointer
 			g = NULL;
 
-			// Get pointer to grid
+			// Get pointer to grid (remains null if it doesn't exist on this rank)
 			GridUtils::getGrid(GridManager::getInstance()->Grids, l, r, g);
 
-			// If the pointer is not updated then it doesn't exist on this rank
-			if (g == NULL)
-			{
-				continue;	// Try find next grid in loop
-			}
-
-			// Expand buffer info arrays by one and add grid ID info
-			buffer_send_info.emplace_back(l, r);
-			buffer_recv_info.emplace_back(l, r);
-
-			/* Not every edge of a grid needs to be communicated.
-			 * We therefore loop over the appropriate region of the grid and 
-			 * check whether a site lies in the associated sender / receiver 
-			 * layer. If so increment the buffer size counter. */
-
-			// Call send and recv size finding routines
-			mpi_buffer_size_send(g);
-			mpi_buffer_size_recv(g);
+			// Global number of sites in each direction at this level used to build a unique key
+			long long numSites[3];
+			for (int d = 0; d < 3; d++) numSites[d] = 1;
+			for (int d = 0; d < L_DIMS; d++) numSites[d] = static_cast<long long>(gm->global_size[d][0]) << l;
+			double dh = L_COARSE_SITE_WIDTH / static_cast<double>(1 << l);
 
-
-#ifdef L_MPI_VERBOSE
-			// Write out buffer sizes for reference
-			*logout << "Send buffer sizes are [L" << buffer_send_info.back().level << ",R" << buffer_send_info.back().region << "]" << '\t';
-			for (int i = 0; i < L_MPI_DIRS; i++) {
-				*logout << buffer_send_info.back().size[i] << '\t';
+			for (int rank = 0; rank < num_ranks; rank++) {
+				requestKeys[rank].clear();
+				recvIds[rank].clear();
 			}
-			*logout << std::endl;
-
-			*logout << "Recv buffer sizes are [L" << buffer_recv_info.back().level << ",R" << buffer_recv_info.back().region << "]" << '\t';
-			for (int i = 0; i < L_MPI_DIRS; i++) {
-				*logout << buffer_recv_info.back().size[i] << '\t';
-			}
-			*logout << std::endl;
-#endif
-
 
-		}
-	}
-
-	*GridUtils::logfile << "Complete." << std::endl;
-
-#ifdef L_MPI_VERBOSE
-	/* Historically, there have been cases of MPI hangs due to buffer
-	* size inconsistencies between ranks. These are difficult to debug
-	* as it involves going through the log files and cross checking
-	* each send and receive by hand. To speed up the process we
-	* implement a debugging activity here to check the send and receive
-	* buffer sizes tally up across the topology. */
-	int * const bufSendSizesOut = new int[L_NUM_LEVELS * L_NUM_REGIONS + 1];
-	int * const bufSendSizesIn = new int[L_NUM_LEVELS * L_NUM_REGIONS + 1];
-	bool bInfoFound = false;
-
-	// Loop over the MPI directions
-	for (int i = 0; i < L_MPI_DIRS; i++)
-	{
-		int counter = 0;
-
-		// Loop over grids and sub-grids and pack buffer one at a time
-		for (int l = 0; l <= L_NUM_LEVELS; l++)
-		{
-			for (int r = 0; r < L_NUM_REGIONS; r++)
+			// Find the owner of each receiver layer site
+			if (g != NULL)
 			{
-				bInfoFound = false;
-				if (l == 0 && r != 0) continue;		// L0 can only be R0
-
-				// Try retireve the buffer size info
-				for (MpiManager::BufferSizeStruct bufs : buffer_send_info)
-				{
-					if (bufs.level == l && bufs.region == r)
-					{
-						bufSendSizesOut[counter] = bufs.size[i];
-						bInfoFound = true;
+				int N_lim = static_cast<int>(g->N_lim), M_lim = static_cast<int>(g->M_lim), K_lim = static_cast<int>(g->K_lim);
+				for (int i = 0; i < N_lim; i++) {
+					for (int j = 0; j < M_lim; j++) {
+						for (int k = 0; k < K_lim; k++) {
+
+							// Refined sites are not passed
+							if (g->LatTyp(i, j, k, M_lim, K_lim) == eRefined) continue;
+							if (!GridUtils::isOnRecvLayer(g->XPos[i], g->YPos[j], g->ZPos[k])) continue;
+
+							position[eXDirection] = g->XPos[i];
+							position[eYDirection] = g->YPos[j];
+							position[eZDirection] = g->ZPos[k];
+							int owner = GridUtils::getRankfromPosition(position);
+							if (owner == my_rank || owner < 0 || owner >= num_ranks)
+								L_ERROR("Receiver layer site on L" + std::to_string(l) + "R" + std::to_string(r) +
+									" has no valid owner. Exiting.", GridUtils::logfile);
+
+							// Global key of the site accounting for periodic wrapping
+							long long key = 0;
+							for (int d = L_DIMS - 1; d >= 0; d--)
+							{
+								long long idx = static_cast<long long>(std::floor(position[d] / dh));
+								idx = (idx % numSites[d] + numSites[d]) % numSites[d];
+								key = key * numSites[d] + idx;
+							}
+							requestKeys[owner].push_back(key);
+							recvIds[owner].push_back(k + j * K_lim + i * K_lim * M_lim);
+						}
 					}
 				}
-
-				// If no info found then grid doesn't exist on this rank so mark as zero
-				if (!bInfoFound) bufSendSizesOut[counter] = 0;
-
-				// Increment counter
-				counter++;
 			}
-		}
 
-		L_INFO("Send sizes packed for direction " + std::to_string(i) + ". Sending to rank " + std::to_string(neighbour_rank[i]) + "...", logout);
-
-		// Once buffer complete, post send
-		MPI_Isend(bufSendSizesOut, L_NUM_LEVELS * L_NUM_REGIONS + 1, MPI_INT, neighbour_rank[i],
-			my_rank, world_comm, &send_requests[i]);
-
-		L_INFO("Sent.", logout);
-
-		// Get opposite direction
-		int opp_i = mpi_getOpposite(i);
-		L_INFO("Receiving send sizes from rank " + std::to_string(neighbour_rank[opp_i]) + " in direction " + std::to_string(opp_i) + "...", logout);
-
-		// Receive the send sizes from opposite direction
-		MPI_Recv(bufSendSizesIn, L_NUM_LEVELS * L_NUM_REGIONS + 1, MPI_INT, neighbour_rank[opp_i],
-			neighbour_rank[opp_i], world_comm, &recv_stat);
+			// Exchange the requests
+			sendKeys.clear();
+			for (int rank = 0; rank < num_ranks; rank++) {
+				sendCounts[rank] = static_cast<int>(requestKeys[rank].size());
+				sendDispls[rank] = static_cast<int>(sendKeys.size());
+				sendKeys.insert(sendKeys.end(), requestKeys[rank].begin(), requestKeys[rank].end());
+			}
+			MPI_Alltoall(&sendCounts[0], 1, MPI_INT, &recvCounts[0], 1, MPI_INT, world_comm);
+			int numRecv = 0;
+			for (int rank = 0; rank < num_ranks; rank++) {
+				recvDispls[rank] = numRecv;
+				numRecv += recvCounts[rank];
+			}
+			recvKeys.resize(numRecv);
+			MPI_Alltoallv(sendKeys.data(), &sendCounts[0], &sendDispls[0], MPI_LONG_LONG,
+				recvKeys.data(), &recvCounts[0], &recvDispls[0], MPI_LONG_LONG, world_comm);
 
-		L_INFO("Received.", logout);
+			// Grids with no neighbours have no list
+			if (g == NULL)
+			{
+				if (numRecv) L_ERROR("Halo sites requested on L" + std::to_string(l) + "R" + std::to_string(r) +
+					" which does not exist on this rank. Exiting.", GridUtils::logfile);
+				continue;
+			}
+			halo_info.emplace_back(l, r);
+			HaloExchangeStruct& halo = halo_info.back();
 
-		// Cross check that the send sizes match the receive sizes
-		counter = 0;
-		// Loop over grids and sub-grids and unpack buffer one at a time
-		for (int l = 0; l <= L_NUM_LEVELS; l++)
-		{
-			for (int r = 0; r < L_NUM_REGIONS; r++)
+			// Build the lists in rank order
+			for (int rank = 0; rank < num_ranks; rank++)
 			{
-				bInfoFound = false;
-				if (l == 0 && r != 0) continue;		// L0 can only be R0
+				if (recvIds[rank].empty() && recvCounts[rank] == 0) continue;
 
-				// Try retireve the buffer size info
-				for (MpiManager::BufferSizeStruct bufr : buffer_recv_info)
+				halo.neighbours.push_back(rank);
+				halo.recv_sites.push_back(recvIds[rank]);
+				halo.send_sites.emplace_back();
+				std::vector<int>& sendIds = halo.send_sites.back();
+				sendIds.reserve(recvCounts[rank]);
+
+				// Convert the requested keys to local sites
+				for (int s = recvDispls[rank]; s < recvDispls[rank] + recvCounts[rank]; s++)
 				{
-					if (bufr.level == l && bufr.region == r)
+					long long key = recvKeys[s];
+					for (int d = 0; d < L_DIMS; d++)
 					{
-						bInfoFound = true;
-						if (bufSendSizesIn[counter] != bufr.size[i])
-						{
-							L_ERROR("L" + std::to_string(l) + "R" + std::to_string(r) + 
-								" -- Mismatch in buffer sizes! Rank " + std::to_string(neighbour_rank[opp_i]) +
-								" is sending " + std::to_string(bufSendSizesIn[counter]) + 
-								". Expected to receive " + std::to_string(bufr.size[i]), GridUtils::logfile);
-						}						
+						position[d] = (static_cast<double>(key % numSites[d]) + 0.5) * dh;
+						key /= numSites[d];
 					}
-				}
 
-				// If no info found then grid doesn't exist on this rank -- make sure buffer size is zero
-				if (!bInfoFound)
-				{
-					if (bufSendSizesIn[counter] != 0)
+					GridUtils::getEnclosingVoxel(position[eXDirection], position[eYDirection], position[eZDirection], g, &ijk);
+					if (GridUtils::isOffGrid(ijk[0], ijk[1], ijk[2], g) ||
+						std::abs(g->XPos[ijk[0]] - position[eXDirection]) > 0.5 * dh ||
+						std::abs(g->YPos[ijk[1]] - position[eYDirection]) > 0.5 * dh
+#if (L_DIMS == 3)
+						|| std::abs(g->ZPos[ijk[2]] - position[eZDirection]) > 0.5 * dh
+#endif
+						)
 					{
-						L_ERROR("L" + std::to_string(l) + "R" + std::to_string(r) + 
-							" -- Mismatch in buffer sizes! Rank " + std::to_string(neighbour_rank[opp_i]) +
-							" is sending " + std::to_string(bufSendSizesIn[counter]) +
-							". Expected to receive 0 as no grid of this L+R on this rank.", GridUtils::logfile);
+						L_ERROR("Rank " + std::to_string(rank) + " requested a site on L" + std::to_string(l) + "R" + std::to_string(r) +
+							" which is not on this rank. Exiting.", GridUtils::logfile);
 					}
+					sendIds.push_back(ijk[2] + ijk[1] * g->K_lim + ijk[0] * g->K_lim * g->M_lim);
 				}
+			}
 
-				// Increment counter
-				counter++;
+
+#ifdef L_MPI_VERBOSE
+			// Write out buffer sizes for reference
+			*logout << "Neighbour list for [L" << l << ",R" << r << "]" << std::endl;
+			for (size_t n = 0; n < halo.neighbours.size(); n++) {
+				*logout << "Rank " << halo.neighbours[n] << ": send " << halo.send_sites[n].size() 
+					<< '\t' << "recv " << halo.recv_sites[n].size() << std::endl;
 			}
-		}		
+#endif
+
+		}
 	}
-	delete[] bufSendSizesOut;
-	delete[] bufSendSizesIn;
 
-#endif
+	*GridUtils::logfile << "Complete." << std::endl;
 
 }
 
 // ************************************************************************* //
-/// \brief	Helper method to find opposite direction in MPI topology.
-///
-///			The MPI directional vectors do not necessarily correspond to the 
-///			lattice model direction. The MPI directional vectors are defined 
-///			separately and hence there is a separate opposite finding method.
+/// \brief	Wait for this rank's turn at a shared resource.
 ///
-/// \param	direction	the outgoing direction whose opposite you wish to find.
-int MpiManager::mpi_getOpposite(int direction) {
+///			Used in place of a loop of global barriers when ranks must access 
+///			a shared file one after another. Rank 0 returns immediately; every 
+///			other rank blocks until the rank below it calls mpi_passTurn(). 
+///			Only the two ranks involved in each hand-over are synchronised.
+void MpiManager::mpi_waitForTurn() {
 
-	/*	If direction is even, then opposite is direction+1.
-		If direction is odd, then opposite is direction-1.
-		e.g. direction 0 (+x direction) has opposite 1 (-x direction) --> +1
-		however, direction 1 has opposite 0 --> -1
-		Hence we can add (-1 ^ direction) so it alternates between +/-1
-	*/
+	if (my_rank > 0)
+		MPI_Recv(nullptr, 0, MPI_INT, my_rank - 1, 0, token_comm, MPI_STATUS_IGNORE);
 
-		return direction + (int)pow(-1,direction);
+}
+
+// ************************************************************************* //
+/// \brief	Pass the turn at a shared resource to the next rank.
+///
+///			Counterpart to mpi_waitForTurn(). The last rank has nobody to pass 
+///			to so returns immediately.
+void MpiManager::mpi_passTurn() {
+
+	if (my_rank < num_ranks - 1)
+		MPI_Send(nullptr, 0, MPI_INT, my_rank + 1, 0, token_comm);
 
 }
 // ************************************************************************* //
@@ -1255,6 +1354,191 @@ void MpiManager::mpi_uniformDecompose(int *numCells)
 	}
 }
 
+// ************************************************************************* //
+/// \brief	Populate the rank size and start arrays using recursive bisection.
+///
+///			The domain is recursively split into two boxes, each assigned half 
+///			of the remaining ranks, with the cut placed so that the estimated 
+///			cost per rank on either side is equal. Any number of ranks may be 
+///			used. Performed on rank 0 and broadcast to the other ranks.
+///
+///	\returns	load imbalance of the resulting decomposition (%).
+double MpiManager::mpi_rcbDecompose()
+{
+	cRankSizeX.resize(num_ranks);
+	cRankSizeY.resize(num_ranks);
+	cRankSizeZ.resize(num_ranks);
+	cRankStartX.resize(num_ranks);
+	cRankStartY.resize(num_ranks);
+	cRankStartZ.resize(num_ranks);
+
+	// Pack the block information for broadcast
+	std::vector<int> buffer(6 * num_ranks);
+	double imbalance = 0.0;
+
+	if (my_rank == 0)
+	{
+		int lo[3] = { 0, 0, 0 };
+		int hi[3] = { L_N, L_M, L_K };
+		mpi_rcbBisect(&lo[0], &hi[0], 0, num_ranks);
+
+		// Compute the resulting imbalance
+		double dh = L_COARSE_SITE_WIDTH;
+		double bounds[6];
+		double costMax = 0.0;
+		double costMin = std::numeric_limits<double>::max();
+		for (int rank = 0; rank < num_ranks; ++rank)
+		{
+			bounds[eXMin] = cRankStartX[rank] * dh;
+			bounds[eXMax] = (cRankStartX[rank] + cRankSizeX[rank]) * dh;
+			bounds[eYMin] = cRankStartY[rank] * dh;
+			bounds[eYMax] = (cRankStartY[rank] + cRankSizeY[rank]) * dh;
+#if (L_DIMS == 3)
+			bounds[eZMin] = cRankStartZ[rank] * dh;
+			bounds[eZMax] = (cRankStartZ[rank] + cRankSizeZ[rank]) * dh;
+#else
+			bounds[eZMin] = 0.0;
+			bounds[eZMax] = GridManager::getInstance()->global_edges[eZMax][0];
+#endif
+			double cost = mpi_SDComputeBlockCost(&bounds[0]);
+			costMax = std::max(costMax, cost);
+			costMin = std::min(costMin, cost);
+		}
+		if (costMax > 0.0) imbalance = (costMax - costMin) * 100.0 / costMax;
+
+		for (int rank = 0; rank < num_ranks; ++rank)
+		{
+			buffer[6 * rank] = cRankStartX[rank];
+			buffer[6 * rank + 1] = cRankStartY[rank];
+			buffer[6 * rank + 2] = cRankStartZ[rank];
+			buffer[6 * rank + 3] = cRankSizeX[rank];
+			buffer[6 * rank + 4] = cRankSizeY[rank];
+			buffer[6 * rank + 5] = cRankSizeZ[rank];
+		}
+	}
+
+	// Broadcast to the other ranks
+	MPI_Bcast(&buffer[0], 6 * num_ranks, MPI_INT, 0, world_comm);
+	MPI_Bcast(&imbalance, 1, MPI_DOUBLE, 0, world_comm);
+	for (int rank = 0; rank < num_ranks; ++rank)
+	{
+		cRankStartX[rank] = buffer[6 * rank];
+		cRankStartY[rank] = buffer[6 * rank + 1];
+		cRankStartZ[rank] = buffer[6 * rank + 2];
+		cRankSizeX[rank] = buffer[6 * rank + 3];
+		cRankSizeY[rank] = buffer[6 * rank + 4];
+		cRankSizeZ[rank] = buffer[6 * rank + 5];
+	}
+
+	L_INFO("Recursive bisection decomposition has a load imbalance of " + std::to_string(imbalance) + "%.", GridUtils::logfile);
+
+	return imbalance;
+}
+
+// ************************************************************************* //
+/// \brief	Split a block between a group of ranks.
+///
+///			The group is split in two and the block cut so the estimated cost 
+///			per rank is the same on both sides. The longest direction is cut 
+///			unless cutting another improves the balance by more than 1%. Each 
+///			half is then split recursively until a single rank remains.
+///
+///	\param	lo			index of the first site of the block in each direction.
+///	\param	hi			index one past the last site of the block in each direction.
+///	\param	firstRank	first rank of the group.
+///	\param	numRanks	number of ranks in the group.
+void MpiManager::mpi_rcbBisect(int *lo, int *hi, int firstRank, int numRanks)
+{
+	// Single rank gets the whole block
+	if (numRanks == 1)
+	{
+		cRankStartX[firstRank] = lo[eXDirection];
+		cRankStartY[firstRank] = lo[eYDirection];
+		cRankStartZ[firstRank] = lo[eZDirection];
+		cRankSizeX[firstRank] = hi[eXDirection] - lo[eXDirection];
+		cRankSizeY[firstRank] = hi[eYDirection] - lo[eYDirection];
+		cRankSizeZ[firstRank] = hi[eZDirection] - lo[eZDirection];
+		return;
+	}
+
+	double dh = L_COARSE_SITE_WIDTH;
+	int numLeft = numRanks / 2;
+	int numRight = numRanks - numLeft;
+
+	// Cost of the block between two indices in a given direction
+	auto blockCost = [&](int d, int from, int to)
+	{
+		double bounds[6];
+		for (int e = 0; e < 3; ++e)
+		{
+			bounds[2 * e] = lo[e] * dh;
+			bounds[2 * e + 1] = hi[e] * dh;
+		}
+		bounds[2 * d] = from * dh;
+		bounds[2 * d + 1] = to * dh;
+#if (L_DIMS != 3)
+		bounds[eZMin] = 0.0;
+		bounds[eZMax] = GridManager::getInstance()->global_edges[eZMax][0];
+#endif
+		return mpi_SDComputeBlockCost(&bounds[0]);
+	};
+
+	// Visit the directions from longest to shortest
+	int order[L_DIMS];
+	for (int d = 0; d < L_DIMS; ++d) order[d] = d;
+	std::stable_sort(order, order + L_DIMS, 
+		[&](int a, int b) { return (hi[a] - lo[a]) > (hi[b] - lo[b]); });
+
+	int bestDir = -1, bestCut = 0;
+	double bestLoad = 0.0;
+	for (int o = 0; o < L_DIMS; ++o)
+	{
+		int d = order[o];
+		if (hi[d] - lo[d] < 2) continue;
+
+		// Find the first cut which puts at least the left share of the cost on the left
+		int a = lo[d] + 1, b = hi[d] - 1;
+		while (a < b)
+		{
+			int mid = (a + b) / 2;
+			if (blockCost(d, lo[d], mid) * numRight >= blockCost(d, mid, hi[d]) * numLeft) b = mid;
+			else a = mid + 1;
+		}
+
+		// Check whether the cut before is better
+		int cut = a;
+		double load = std::max(blockCost(d, lo[d], cut) / numLeft, blockCost(d, cut, hi[d]) / numRight);
+		if (cut - 1 > lo[d])
+		{
+			double loadPrev = std::max(blockCost(d, lo[d], cut - 1) / numLeft, blockCost(d, cut - 1, hi[d]) / numRight);
+			if (loadPrev < load)
+			{
+				cut--;
+				load = loadPrev;
+			}
+		}
+
+		if (bestDir < 0 || load < 0.99 * bestLoad)
+		{
+			bestDir = d;
+			bestCut = cut;
+			bestLoad = load;
+		}
+	}
+
+	if (bestDir < 0)
+		L_ERROR("Block is too small to be split between " + std::to_string(numRanks) + 
+			" ranks. Exiting. Reduce the number of ranks or increase the resolution.", GridUtils::logfile);
+
+	// Recurse into each half
+	int loRight[3] = { lo[0], lo[1], lo[2] };
+	int hiLeft[3] = { hi[0], hi[1], hi[2] };
+	hiLeft[bestDir] = bestCut;
+	loRight[bestDir] = bestCut;
+	mpi_rcbBisect(lo, &hiLeft[0], firstRank, numLeft);
+	mpi_rcbBisect(&loRight[0], hi, firstRank + numLeft, numRight);
+}
+
 // ************************************************************************* //
 /// \brief	Checks whether the perturbation vector is valid and adjusts delta 
 ///			if necessary.
@@ -1380,9 +1664,9 @@ void MpiManager::mpi_SDReconstructSolution(SDData& solutionData, std::vector<int
 void MpiManager::mpi_SDComputeImbalance(LoadImbalanceData& load,
 	SDData& solutionData, std::vector<int>& numCores)
 {
-	size_t count = 0;
-	size_t countMax = 0;
-	size_t countMin = std::numeric_limits<size_t>::max();
+	double count = 0.0;
+	double countMax = 0.0;
+	double countMin = std::numeric_limits<double>::max();
 
 	// Construct bounds for each block and then find active cell count from grid manager
 	double bounds[6];
@@ -1400,8 +1684,8 @@ void MpiManager::mpi_SDComputeImbalance(LoadImbalanceData& load,
 				bounds[eZMin] = solutionData.ZSol[k];
 				bounds[eZMax] = solutionData.ZSol[k + 1];
 
-				// Get active operation count
-				count = GridManager::getInstance()->getActiveCellCount(&bounds[0], true);
+				// Get active operation count (weighted by measured cost if rebalancing)
+				count = mpi_SDComputeBlockCost(&bounds[0]);
 
 				// Update the extremes
 				if (count > countMax)
@@ -1419,11 +1703,54 @@ void MpiManager::mpi_SDComputeImbalance(LoadImbalanceData& load,
 
 	// Update load imbalance
 	load.loadImbalance = 
-		std::abs(static_cast<double>(countMax) - static_cast<double>(countMin)) * 100.0 / static_cast<double>(countMax);
-	load.heaviestOps = countMax;
+		std::abs(countMax - countMin) * 100.0 / countMax;
+	load.heaviestOps = static_cast<size_t>(countMax);
 
 }
 
+// ************************************************************************* //
+/// \brief	Estimate the cost of a block for the decomposition.
+///
+///			By default this is the cost model estimate within the bounds.
+///			When rebalancing at run time, each rank's measured cost per 
+///			unit of modelled cost is stored in rank_cost_per_op and the block 
+///			cost is the sum of the modelled cost it takes from each of the 
+///			current rank blocks weighted by that rank's measured cost.
+///
+///	\param	bounds	pointer to an array containing the bounds of the block.
+///	\returns		estimated cost of the block in operations.
+double MpiManager::mpi_SDComputeBlockCost(double *bounds)
+{
+	GridManager *gm = GridManager::getInstance();
+
+	// Unweighted case
+	if (rank_cost_per_op.empty())
+		return gm->getBlockCost(bounds);
+
+	// Sum the contribution of the overlap with each current block
+	double cost = 0.0;
+	double overlap[6];
+	for (int rank = 0; rank < num_ranks; ++rank)
+	{
+		bool bOverlaps = true;
+		for (int d = 0; d < L_DIMS; ++d)
+		{
+			overlap[2 * d] = std::max(bounds[2 * d], rank_cost_edge[2 * d][rank]);
+			overlap[2 * d + 1] = std::min(bounds[2 * d + 1], rank_cost_edge[2 * d + 1][rank]);
+			if (overlap[2 * d + 1] <= overlap[2 * d]) bOverlaps = false;
+		}
+		if (!bOverlaps) continue;
+#if (L_DIMS != 3)
+		overlap[eZMin] = bounds[eZMin];
+		overlap[eZMax] = bounds[eZMax];
+#endif
+
+		cost += rank_cost_per_op[rank] * gm->getBlockCost(&overlap[0]);
+	}
+
+	return cost;
+}
+
 // ************************************************************************* //
 /// \brief	Populate the rank size arrays based on an algorithm that seeks to 
 ///			load balance.
@@ -1440,9 +1767,9 @@ MpiManager::LoadImbalanceData MpiManager::mpi_smartDecompose(double dh, std::vec
 	std::vector<int> numCores(3);
 	if (!reqDims.size())
 	{
-		numCores[eXDirection] = L_MPI_XCORES;
-		numCores[eYDirection] = L_MPI_YCORES;
-		numCores[eZDirection] = L_MPI_ZCORES;
+		numCores[eXDirection] = dimensions[eXDirection];
+		numCores[eYDirection] = dimensions[eYDirection];
+		numCores[eZDirection] = dimensions[eZDirection];
 	}
 	else
 	{
@@ -1499,7 +1826,20 @@ MpiManager::LoadImbalanceData MpiManager::mpi_smartDecompose(double dh, std::vec
 			// Upper edge of block is a variable
 			for (i = 0; i < numCores[d] - 1; ++i)
 			{
-				solutionData.theta[c] = (i + 1) * uniSpace * dh;
+				if (rank_cost_per_op.empty())
+				{
+					solutionData.theta[c] = (i + 1) * uniSpace * dh;
+				}
+				else
+				{
+					/* When rebalancing start from the current decomposition 
+					 * so the result can be no worse than what is running. */
+					int coords[3] = { 0, 0, 0 };
+					int rank;
+					coords[d] = i;
+					MPI_Cart_rank(world_comm, coords, &rank);
+					solutionData.theta[c] = rank_cost_edge[2 * d + 1][rank];
+				}
 				c++;
 			}
 		}
@@ -1514,7 +1854,10 @@ MpiManager::LoadImbalanceData MpiManager::mpi_smartDecompose(double dh, std::vec
 		// Update uniform decomposition quantity
 		load.uniImbalance = load.loadImbalance;
 #ifndef L_MPI_TOPOLOGY_REPORT
-		L_INFO("Uniform decomposition produces an imbalance of " + std::to_string(load.uniImbalance) + "%.", GridUtils::logfile);
+		if (rank_cost_per_op.empty())
+			L_INFO("Uniform decomposition produces an imbalance of " + std::to_string(load.uniImbalance) + "%.", GridUtils::logfile);
+		else
+			L_INFO("Current decomposition estimated to produce an imbalance of " + std::to_string(load.uniImbalance) + "%.", GridUtils::logfile);
 #endif
 
 		// Temporaries
@@ -1651,7 +1994,7 @@ void MpiManager::mpi_SDCommunicateSolution(SDData& solutionData, double imbalanc
 	}
 
 	// Update ranks sizes from solution
-	MPI_Bcast(bufRankSizeStart, L_MPI_XCORES * L_MPI_YCORES * L_MPI_ZCORES * L_DIMS, MPI_INT, 0, world_comm);
+	MPI_Bcast(bufRankSizeStart, num_ranks * L_DIMS, MPI_INT, 0, world_comm);
 	int blockIdx = 0;
 	bufRankSize = bufRankSizeStart;
 	for (int i = 0; i < dimensions[eXDirection]; i++)
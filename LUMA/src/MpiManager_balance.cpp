@@ -0,0 +1,382 @@
+/*
+* --------------------------------------------------------------
+*
+* ------ Lattice Boltzmann @ The University of Manchester ------
+*
+* -------------------------- L-U-M-A ---------------------------
+*
+* Copyright 2018 The University of Manchester
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.*
+*/
+
+#include "../inc/stdafx.h"
+#include "../inc/GridObj.h"
+#include "../inc/ObjectManager.h"
+
+/* Layout of a site record used for migration:
+ * level, region, x, y, z, type, rho, u[L_DIMS], f[L_NUM_VELS], fNew[L_NUM_VELS]
+ * followed by the time-averaged quantities if they are being computed. */
+#ifdef L_COMPUTE_TIME_AVERAGED_QUANTITIES
+static const int siteRecordSize = 7 + L_DIMS + 2 * L_NUM_VELS + 1 + L_DIMS + (3 * L_DIMS - 3);
+#else
+static const int siteRecordSize = 7 + L_DIMS + 2 * L_NUM_VELS;
+#endif
+
+
+// ************************************************************************* //
+/// \brief	Rebalance the decomposition using measured step times.
+///
+///			Called by all ranks. The measured work time of each rank is
+///			gathered and, if the imbalance exceeds L_MPI_REBALANCE_TOL, the
+///			decomposition is rerun with each rank's operations weighted
+///			by its measured cost. The grids are then re-initialised in place
+///			on the new blocks and the lattice data and IB markers migrated to
+///			their new owners. The sub-grid hierarchy held by each rank cannot
+///			change in place so decompositions which would alter it are
+///			rejected and the current one kept. BFL bodies store site indices
+///			which are not remapped so rebalancing is disabled when present.
+///
+///	\param	grid_man	pointer to non-null grid manager.
+///	\param	work_time	time this rank has spent computing since the last check.
+///	\returns			true if the domain was redecomposed.
+bool MpiManager::mpi_rebalance(GridManager* const grid_man, double work_time)
+{
+	// Nothing to balance with a single rank
+	if (num_ranks == 1) return false;
+
+	// Gather the measured times
+	std::vector<double> rank_time(num_ranks, 0.0);
+	MPI_Allgather(&work_time, 1, MPI_DOUBLE, &rank_time[0], 1, MPI_DOUBLE, world_comm);
+
+	// Imbalance measured in the same way as the decomposition
+	double timeMax = *std::max_element(rank_time.begin(), rank_time.end());
+	double timeMin = *std::min_element(rank_time.begin(), rank_time.end());
+	if (timeMax <= 0.0) return false;
+	double imbalance = (timeMax - timeMin) * 100.0 / timeMax;
+	L_INFO("Measured load imbalance of " + std::to_string(imbalance) + "%.", GridUtils::logfile);
+	if (imbalance < L_MPI_REBALANCE_TOL) return false;
+
+	// BFL bodies store local site indices so cannot be migrated
+	int hasBFL = ObjectManager::getInstance()->pBody.size() > 0 ? 1 : 0;
+	MPI_Allreduce(MPI_IN_PLACE, &hasBFL, 1, MPI_INT, MPI_MAX, world_comm);
+	if (hasBFL)
+	{
+		L_WARN("Rebalancing is not supported with BFL bodies. Keeping current decomposition.", GridUtils::logfile);
+		return false;
+	}
+
+	/* Compute the measured cost of a unit of modelled cost on each rank from 
+	 * the measured time and the cost model estimate for its block. Costs are 
+	 * normalised so the weighted cost is still in fluid site updates. */
+	double bounds[6];
+	double totalOps = 0.0, totalTime = 0.0;
+	rank_cost_edge = rank_core_edge;
+	rank_cost_per_op.resize(num_ranks);
+	for (int rank = 0; rank < num_ranks; ++rank)
+	{
+		for (int e = 0; e < 6; ++e) bounds[e] = rank_core_edge[e][rank];
+		double ops = grid_man->getBlockCost(&bounds[0]);
+		rank_cost_per_op[rank] = (ops > 0.0) ? rank_time[rank] / ops : 0.0;
+		totalOps += ops;
+		totalTime += rank_time[rank];
+	}
+	for (int rank = 0; rank < num_ranks; ++rank)
+		rank_cost_per_op[rank] *= totalOps / totalTime;
+
+	// Keep the current decomposition in case it must be restored
+	std::vector<int> oldSizeX(cRankSizeX), oldSizeY(cRankSizeY), oldSizeZ(cRankSizeZ);
+	std::vector<int> oldStartX(cRankStartX), oldStartY(cRankStartY), oldStartZ(cRankStartZ);
+
+	// Rerun the decomposition with the measured costs
+	L_INFO("Rebalancing domain decomposition...", GridUtils::logfile);
+#ifdef L_MPI_RCB_DECOMPOSE
+	mpi_rcbDecompose();
+#else
+	mpi_smartDecompose(L_COARSE_SITE_WIDTH);
+#endif
+	rank_cost_per_op.clear();
+	rank_cost_edge.clear();
+
+	// Check whether anything changed
+	if (cRankSizeX == oldSizeX && cRankSizeY == oldSizeY && cRankSizeZ == oldSizeZ &&
+		cRankStartX == oldStartX && cRankStartY == oldStartY && cRankStartZ == oldStartZ)
+	{
+		L_INFO("Decomposition unchanged.", GridUtils::logfile);
+		return false;
+	}
+
+	// Pack the core sites while the old halo positions are still set
+	std::vector<double> siteData;
+	mpi_rebalancePack(grid_man, siteData);
+
+	// Rebuild the grids in place on the new blocks
+	mpi_updateBlockEdges(grid_man);
+	int bUnchanged = grid_man->Grids->LBM_reinitialiseGrid() ? 1 : 0;
+	MPI_Allreduce(MPI_IN_PLACE, &bUnchanged, 1, MPI_INT, MPI_MIN, world_comm);
+
+	// Restore the old decomposition if the sub-grid hierarchy would change
+	bool bRebalanced = true;
+	if (!bUnchanged)
+	{
+		L_WARN("New decomposition would change the sub-grids held by a rank. Keeping current decomposition.", GridUtils::logfile);
+		cRankSizeX = oldSizeX;
+		cRankSizeY = oldSizeY;
+		cRankSizeZ = oldSizeZ;
+		cRankStartX = oldStartX;
+		cRankStartY = oldStartY;
+		cRankStartZ = oldStartZ;
+		mpi_updateBlockEdges(grid_man);
+		grid_man->Grids->LBM_reinitialiseGrid();
+		bRebalanced = false;
+	}
+
+	// Send the sites to their owners
+	mpi_rebalanceMigrate(grid_man, siteData);
+
+	// Rebuild the neighbour lists and writable data information
+	mpi_buffer_size();
+	for (int c = 0; c < L_NUM_LEVELS * L_NUM_REGIONS; ++c)
+	{
+		if (subGrid_comm[c] != MPI_COMM_NULL) MPI_Comm_free(&subGrid_comm[c]);
+	}
+	grid_man->p_data.clear();
+	mpi_buildCommunicators(grid_man);
+
+	// Move IB markers to their new ranks and rebuild the support
+#ifdef L_IBM_ON
+	ObjectManager *objman = ObjectManager::getInstance();
+	for (int lev = 0; lev <= rankGrids[my_rank]; ++lev)
+		objman->ibm_updateMarkers(lev, true);
+	objman->ibm_initialise();
+#endif
+
+	// Report the new balance
+	mpi_updateLoadInfo(grid_man);
+	if (bRebalanced)
+	{
+		L_INFO("Domain rebalanced. Limits of the grid core (position) are now ("
+			+ std::to_string(rank_core_edge[eXMin][my_rank]) + "-" + std::to_string(rank_core_edge[eXMax][my_rank]) + ", "
+			+ std::to_string(rank_core_edge[eYMin][my_rank]) + "-" + std::to_string(rank_core_edge[eYMax][my_rank]) + ", "
+			+ std::to_string(rank_core_edge[eZMin][my_rank]) + "-" + std::to_string(rank_core_edge[eZMax][my_rank]) +
+			")", GridUtils::logfile);
+	}
+
+	return bRebalanced;
+}
+
+// ************************************************************************* //
+/// \brief	Pack the core sites of every grid on this rank for migration.
+///
+///			Receiver layer sites are excluded as these are duplicates of
+///			sites owned by a neighbour. Must be called before the halo
+///			positions are updated for the new decomposition.
+///
+///	\param		grid_man	pointer to non-null grid manager.
+///	\param[out]	siteData	buffer of site records.
+void MpiManager::mpi_rebalancePack(GridManager* const grid_man, std::vector<double>& siteData)
+{
+	siteData.clear();
+
+	for (int lev = 0; lev <= L_NUM_LEVELS; ++lev)
+	{
+		for (int reg = 0; reg < L_NUM_REGIONS; ++reg)
+		{
+			// L0 can only be region 0
+			if (lev == 0 && reg != 0) continue;
+
+			GridObj *g = nullptr;
+			GridUtils::getGrid(grid_man->Grids, lev, reg, g);
+			if (!g) continue;
+
+			int M_lim = g->M_lim;
+			int K_lim = g->K_lim;
+
+			for (int i = 0; i < g->N_lim; ++i)
+			{
+				for (int j = 0; j < M_lim; ++j)
+				{
+					for (int k = 0; k < K_lim; ++k)
+					{
+						// Skip duplicates in the receiver layer
+						if (GridUtils::isOnRecvLayer(g->XPos[i], g->YPos[j], g->ZPos[k])) continue;
+
+						int id = k + j * K_lim + i * K_lim * M_lim;
+
+						siteData.push_back(lev);
+						siteData.push_back(reg);
+						siteData.push_back(g->XPos[i]);
+						siteData.push_back(g->YPos[j]);
+						siteData.push_back(g->ZPos[k]);
+						siteData.push_back(static_cast<double>(g->LatTyp[id]));
+						siteData.push_back(g->rho[id]);
+						for (int d = 0; d < L_DIMS; ++d)
+							siteData.push_back(g->u[d + id * L_DIMS]);
+						for (int v = 0; v < L_NUM_VELS; ++v)
+							siteData.push_back(g->f[v + id * L_NUM_VELS]);
+						for (int v = 0; v < L_NUM_VELS; ++v)
+							siteData.push_back(g->fNew[v + id * L_NUM_VELS]);
+#ifdef L_COMPUTE_TIME_AVERAGED_QUANTITIES
+						siteData.push_back(g->rho_timeav[id]);
+						for (int d = 0; d < L_DIMS; ++d)
+							siteData.push_back(g->ui_timeav[d + id * L_DIMS]);
+						for (int d = 0; d < 3 * L_DIMS - 3; ++d)
+							siteData.push_back(g->uiuj_timeav[d + id * (3 * L_DIMS - 3)]);
+#endif
+					}
+				}
+			}
+		}
+	}
+}
+
+// ************************************************************************* //
+/// \brief	Send packed sites to the ranks which now hold them and unpack.
+///
+///			Each site is sent to every rank whose core or receiver layer
+///			contains it so the halos are also populated and no separate
+///			halo exchange is required. Receiver layer sites have their
+///			macroscopic quantities recomputed as they would after a halo
+///			exchange. Must be called after the grids have been rebuilt.
+///
+///	\param	grid_man	pointer to non-null grid manager.
+///	\param	siteData	buffer of site records packed by mpi_rebalancePack().
+void MpiManager::mpi_rebalanceMigrate(GridManager* const grid_man, std::vector<double>& siteData)
+{
+	double dh = L_COARSE_SITE_WIDTH;
+
+	/* A block has a halo in a direction unless it spans the whole domain in 
+	 * that direction in which case only its core can hold the site. */
+	std::vector<int> haloWidth(3 * num_ranks, 0);
+	for (int rank = 0; rank < num_ranks; ++rank)
+	{
+		for (int d = 0; d < L_DIMS; ++d)
+		{
+			double length = grid_man->global_edges[2 * d + 1][0];
+			if (rank_core_edge[2 * d + 1][rank] - rank_core_edge[2 * d][rank] < length - 0.5 * dh)
+				haloWidth[d + 3 * rank] = 1;
+		}
+	}
+
+	// Sort the records by destination
+	std::vector< std::vector<double> > sendData(num_ranks);
+	size_t numSites = siteData.size() / siteRecordSize;
+	for (size_t s = 0; s < numSites; ++s)
+	{
+		const double *record = &siteData[s * siteRecordSize];
+
+		// Add to the buffer of each rank whose core or receiver layer contains the site
+		for (int rank = 0; rank < num_ranks; ++rank)
+		{
+			bool bContains = true;
+			for (int d = 0; d < L_DIMS && bContains; ++d)
+			{
+				double length = grid_man->global_edges[2 * d + 1][0];
+				double halo = haloWidth[d + 3 * rank] * dh;
+				bContains = false;
+				for (int wrap = -1; wrap <= 1; ++wrap)
+				{
+					double pos = record[2 + d] + wrap * length;
+					if (pos >= rank_core_edge[2 * d][rank] - halo && pos < rank_core_edge[2 * d + 1][rank] + halo)
+					{
+						bContains = true;
+						break;
+					}
+				}
+			}
+
+			if (bContains)
+			{
+				std::vector<double>& buf = sendData[rank];
+				buf.insert(buf.end(), record, record + siteRecordSize);
+			}
+		}
+	}
+	siteData.clear();
+	siteData.shrink_to_fit();
+
+	// Exchange sizes
+	std::vector<int> sendCounts(num_ranks), recvCounts(num_ranks);
+	std::vector<int> sendDispls(num_ranks, 0), recvDispls(num_ranks, 0);
+	for (int rank = 0; rank < num_ranks; ++rank)
+		sendCounts[rank] = static_cast<int>(sendData[rank].size());
+	MPI_Alltoall(&sendCounts[0], 1, MPI_INT, &recvCounts[0], 1, MPI_INT, world_comm);
+	for (int rank = 1; rank < num_ranks; ++rank)
+	{
+		sendDispls[rank] = sendDispls[rank - 1] + sendCounts[rank - 1];
+		recvDispls[rank] = recvDispls[rank - 1] + recvCounts[rank - 1];
+	}
+
+	// Flatten and exchange the records
+	std::vector<double> sendBuffer;
+	sendBuffer.reserve(sendDispls.back() + sendCounts.back());
+	for (int rank = 0; rank < num_ranks; ++rank)
+	{
+		sendBuffer.insert(sendBuffer.end(), sendData[rank].begin(), sendData[rank].end());
+		std::vector<double>().swap(sendData[rank]);
+	}
+	std::vector<double> recvBuffer(recvDispls.back() + recvCounts.back());
+	MPI_Alltoallv(sendBuffer.data(), &sendCounts[0], &sendDispls[0], MPI_DOUBLE,
+		recvBuffer.data(), &recvCounts[0], &recvDispls[0], MPI_DOUBLE, world_comm);
+	std::vector<double>().swap(sendBuffer);
+
+	// Unpack into the rebuilt grids
+	std::vector<int> ijk;
+	size_t missed = 0;
+	numSites = recvBuffer.size() / siteRecordSize;
+	for (size_t s = 0; s < numSites; ++s)
+	{
+		const double *record = &recvBuffer[s * siteRecordSize];
+
+		// Get grid and local indices
+		GridObj *g = nullptr;
+		GridUtils::getGrid(grid_man->Grids, static_cast<int>(record[0]), static_cast<int>(record[1]), g);
+		if (!g)
+		{
+			missed++;
+			continue;
+		}
+		GridUtils::getEnclosingVoxel(record[2], record[3], record[4], g, &ijk);
+		if (GridUtils::isOffGrid(ijk[0], ijk[1], ijk[2], g))
+		{
+			missed++;
+			continue;
+		}
+		int id = ijk[2] + ijk[1] * g->K_lim + ijk[0] * g->K_lim * g->M_lim;
+
+		// Copy the data
+		int idx = 5;
+		g->LatTyp[id] = static_cast<eType>(static_cast<int>(record[idx++]));
+		g->rho[id] = record[idx++];
+		for (int d = 0; d < L_DIMS; ++d)
+			g->u[d + id * L_DIMS] = record[idx++];
+		for (int v = 0; v < L_NUM_VELS; ++v)
+			g->f[v + id * L_NUM_VELS] = record[idx++];
+		for (int v = 0; v < L_NUM_VELS; ++v)
+			g->fNew[v + id * L_NUM_VELS] = record[idx++];
+#ifdef L_COMPUTE_TIME_AVERAGED_QUANTITIES
+		g->rho_timeav[id] = record[idx++];
+		for (int d = 0; d < L_DIMS; ++d)
+			g->ui_timeav[d + id * L_DIMS] = record[idx++];
+		for (int d = 0; d < 3 * L_DIMS - 3; ++d)
+			g->uiuj_timeav[d + id * (3 * L_DIMS - 3)] = record[idx++];
+#endif
+
+		// Halo sites get their macroscopic values as they would from a halo exchange
+		if (GridUtils::isOnRecvLayer(record[2], record[3], record[4]))
+			g->LBM_macro(ijk[0], ijk[1], ijk[2]);
+	}
+
+	if (missed)
+		L_WARN(std::to_string(missed) + " migrated sites could not be placed on a grid on this rank.", GridUtils::logfile);
+}
@@ -26,21 +26,68 @@
 
 
 
+// *****************************************************************************
+///	\brief	Exchange flat IBM buffers with neighbouring ranks
+///
+///			The send buffer must already be packed. Only the ranks in the
+///			neighbour lists are visited and the receive buffer is reused
+///			between calls.
+///
+///	\param	sendList		neighbour list whose buffer is sent
+///	\param	recvList		neighbour list whose buffer is received into
+///	\param	stride			number of values per unit entry size
+///	\param	tag				message tag of this exchange
+void MpiManager::mpi_ibmExchange(IBCommNeighbourList &sendList, IBCommNeighbourList &recvList, int stride, int tag) {
+
+	// Size the receive buffer
+	recvList.buffer.resize(recvList.displs.back() * stride);
+
+	// Requests for all receives and sends
+	std::vector<MPI_Request> requests(recvList.ranks.size() + sendList.ranks.size(), MPI_REQUEST_NULL);
+
+	// Post receives first
+	int count;
+	for (size_t n = 0; n < recvList.ranks.size(); n++) {
+		count = (recvList.displs[n + 1] - recvList.displs[n]) * stride;
+		if (count > 0) {
+			MPI_Irecv(&recvList.buffer[recvList.displs[n] * stride], count,
+				MPI_DOUBLE, recvList.ranks[n], tag, world_comm, &requests[n]);
+		}
+	}
+
+	// Now post the sends
+	for (size_t n = 0; n < sendList.ranks.size(); n++) {
+		count = (sendList.displs[n + 1] - sendList.displs[n]) * stride;
+		if (count > 0) {
+			MPI_Isend(&sendList.buffer[sendList.displs[n] * stride], count,
+				MPI_DOUBLE, sendList.ranks[n], tag, world_comm, &requests[recvList.ranks.size() + n]);
+		}
+	}
+
+	// Wait for all messages to complete
+	if (requests.size() > 0)
+		MPI_Waitall(static_cast<int>(requests.size()), &requests.front(), MPI_STATUSES_IGNORE);
+}
+
+
 // *****************************************************************************
 ///	\brief	Do communication required for spreading to off-rank support points
 ///
+///			Received forces are left in the buffer of the support-side
+///			neighbour list in the order of the support-side comm entries.
+///
 ///	\param	level			current grid level
-///	\param	spreadForces	forces that have been spread
-void MpiManager::mpi_spreadComm(int level, std::vector<std::vector<double>> &spreadForces) {
+void MpiManager::mpi_spreadComm(int level) {
 
 	// Get object manager instance
 	ObjectManager *objman = ObjectManager::getInstance();
 
 	// Declare values
-	int toRank, ib , m, s;
-	std::vector<std::vector<double>> sendForce(num_ranks, std::vector<double>(0));
+	int ib , m, s, pos;
+	IBCommNeighbourList &sendList = supportNbrMarkerSide[level];
+	sendList.buffer.resize(sendList.displs.back() * L_DIMS);
 
-	// Pack and send data first
+	// Pack data
 	for (int i = 0; i < supportCommMarkerSide[level].size(); i++) {
 
 		// Get body index
@@ -49,8 +96,8 @@ void MpiManager::mpi_spreadComm(int level, std::vector<std::vector<double>> &spr
 		// Only pack if body belongs to current grid level
 		if (objman->iBody[ib]._Owner->level == level) {
 
-			// Get rank to send to and support ID info
-			toRank = supportCommMarkerSide[level][i].rankComm;
+			// Get position in buffer and support ID info
+			pos = sendList.entryDispl[i] * L_DIMS;
 			m = supportCommMarkerSide[level][i].markerIdx;
 			s = supportCommMarkerSide[level][i].supportID;
 
@@ -63,64 +110,36 @@ void MpiManager::mpi_spreadComm(int level, std::vector<std::vector<double>> &spr
 
 			// Pack into buffer
 			for (int dir = 0; dir < L_DIMS; dir++) {
-				sendForce[toRank].push_back(objman->iBody[ib].markers[m].deltaval[s] * objman->iBody[ib].markers[m].force_xyz[dir] *
-						volWidth * volDepth * objman->iBody[ib].markers[m].ds);
+				sendList.buffer[pos + dir] = objman->iBody[ib].markers[m].deltaval[s] * objman->iBody[ib].markers[m].force_xyz[dir] *
+						volWidth * volDepth * objman->iBody[ib].markers[m].ds;
 			}
 		}
 	}
 
-	// Now send the values
-	std::vector<MPI_Request> sendRequests;
-	for (int toRank = 0; toRank < num_ranks; toRank++) {
-
-		// Check if current rank needs to send stuff to rank toRank
-		if (sendForce[toRank].size() > 0) {
-			sendRequests.push_back(MPI_REQUEST_NULL);
-			MPI_Isend(&sendForce[toRank].front(), static_cast<int>(sendForce[toRank].size()),
-				MPI_DOUBLE, toRank, my_rank, world_comm, &sendRequests.back());
-		}
-	}
-
-	// Get receive sizes from each rank
-	std::vector<int> bufferSize(num_ranks, 0);
-	for (int i = 0; i < supportCommSupportSide[level].size(); i++) {
-		if (objman->iBody[objman->bodyIDToIdx[supportCommSupportSide[level][i].bodyID]]._Owner->level == level)
-			bufferSize[supportCommSupportSide[level][i].rankComm] += L_DIMS;
-	}
-
-	// Now receive the velocity values
-	spreadForces.resize(num_ranks, std::vector<double>(0));
-	for (int fromRank = 0; fromRank < num_ranks; fromRank++) {
-
-		// If there is data to receive from rank fromRank
-		if (bufferSize[fromRank] > 0) {
-			spreadForces[fromRank].resize(bufferSize[fromRank]);
-			MPI_Recv(&spreadForces[fromRank].front(), static_cast<int>(spreadForces[fromRank].size()),
-				MPI_DOUBLE, fromRank, fromRank, world_comm, MPI_STATUS_IGNORE);
-		}
-	}
-
-	// If sending any messages then wait for request status
-	MPI_Waitall(static_cast<int>(sendRequests.size()), &sendRequests.front(), MPI_STATUS_IGNORE);
+	// Exchange with neighbours
+	mpi_ibmExchange(sendList, supportNbrSupportSide[level], L_DIMS, eIBTagSpread);
 }
 
 
 // *****************************************************************************
 ///	\brief	Do communication required for interpolating from off-rank support points
 ///
+///			Received density and momentum are left in the buffer of the 
+///			marker-side neighbour list in the order of the marker-side comm 
+///			entries.
+///
 ///	\param	level			current grid level
-///	\param	recvVel			velocities that have been interpolated
-void MpiManager::mpi_interpolateComm(int level, std::vector<std::vector<double>> &recvVel) {
+void MpiManager::mpi_interpolateComm(int level) {
 
 	// Get object manager instance
 	ObjectManager *objman = ObjectManager::getInstance();
 
 	// Declare values
-	int toRank, ib;
-	std::vector<int> idx(3, 0);
-	std::vector<std::vector<double>> sendVel(num_ranks, std::vector<double>(0));
+	int ib, pos;
+	IBCommNeighbourList &sendList = supportNbrSupportSide[level];
+	sendList.buffer.resize(sendList.displs.back() * (L_DIMS + 1));
 
-	// Pack and send data first
+	// Pack data
 	for (int i = 0; i < supportCommSupportSide[level].size(); i++) {
 
 		// Get body ID
@@ -129,8 +148,8 @@ void MpiManager::mpi_interpolateComm(int level, std::vector<std::vector<double>>
 		// Only pack if body belongs to current grid level
 		if (objman->iBody[ib]._Owner->level == level) {
 
-			// Get rank to send to
-			toRank = supportCommSupportSide[level][i].rankComm;
+			// Get position in buffer
+			pos = sendList.entryDispl[i] * (L_DIMS + 1);
 
 			// Get grid sizes
 			size_t M_lim = objman->iBody[ib]._Owner->M_lim;
@@ -139,65 +158,34 @@ void MpiManager::mpi_interpolateComm(int level, std::vector<std::vector<double>>
 #endif
 
 			// Get indices
-			idx = supportCommSupportSide[level][i].supportIdx;
+			const std::vector<int> &idx = supportCommSupportSide[level][i].supportIdx;
 
 			// Pack density and momentum into buffer
 #if (L_DIMS == 2)
-			sendVel[toRank].push_back(objman->iBody[ib]._Owner->rho(idx[eXDirection], idx[eYDirection], M_lim));
+			sendList.buffer[pos] = objman->iBody[ib]._Owner->rho(idx[eXDirection], idx[eYDirection], M_lim);
 
-			sendVel[toRank].push_back(objman->iBody[ib]._Owner->rho(idx[eXDirection], idx[eYDirection], M_lim) *
-									  objman->iBody[ib]._Owner->u(idx[eXDirection], idx[eYDirection], eXDirection, M_lim, L_DIMS));
+			sendList.buffer[pos + 1] = objman->iBody[ib]._Owner->rho(idx[eXDirection], idx[eYDirection], M_lim) *
+									   objman->iBody[ib]._Owner->u(idx[eXDirection], idx[eYDirection], eXDirection, M_lim, L_DIMS);
 
-			sendVel[toRank].push_back(objman->iBody[ib]._Owner->rho(idx[eXDirection], idx[eYDirection], M_lim) *
-									  objman->iBody[ib]._Owner->u(idx[eXDirection], idx[eYDirection], eYDirection, M_lim, L_DIMS));
+			sendList.buffer[pos + 2] = objman->iBody[ib]._Owner->rho(idx[eXDirection], idx[eYDirection], M_lim) *
+									   objman->iBody[ib]._Owner->u(idx[eXDirection], idx[eYDirection], eYDirection, M_lim, L_DIMS);
 #elif (L_DIMS == 3)
-			sendVel[toRank].push_back(objman->iBody[ib]._Owner->rho(idx[eXDirection], idx[eYDirection], idx[eZDirection], M_lim, K_lim));
+			sendList.buffer[pos] = objman->iBody[ib]._Owner->rho(idx[eXDirection], idx[eYDirection], idx[eZDirection], M_lim, K_lim);
 
-			sendVel[toRank].push_back(objman->iBody[ib]._Owner->rho(idx[eXDirection], idx[eYDirection], idx[eZDirection], M_lim, K_lim) *
-									  objman->iBody[ib]._Owner->u(idx[eXDirection], idx[eYDirection], idx[eZDirection], eXDirection, M_lim, K_lim, L_DIMS));
+			sendList.buffer[pos + 1] = objman->iBody[ib]._Owner->rho(idx[eXDirection], idx[eYDirection], idx[eZDirection], M_lim, K_lim) *
+									   objman->iBody[ib]._Owner->u(idx[eXDirection], idx[eYDirection], idx[eZDirection], eXDirection, M_lim, K_lim, L_DIMS);
 
-			sendVel[toRank].push_back(objman->iBody[ib]._Owner->rho(idx[eXDirection], idx[eYDirection], idx[eZDirection], M_lim, K_lim) *
-									  objman->iBody[ib]._Owner->u(idx[eXDirection], idx[eYDirection], idx[eZDirection], eYDirection, M_lim, K_lim, L_DIMS));
+			sendList.buffer[pos + 2] = objman->iBody[ib]._Owner->rho(idx[eXDirection], idx[eYDirection], idx[eZDirection], M_lim, K_lim) *
+									   objman->iBody[ib]._Owner->u(idx[eXDirection], idx[eYDirection], idx[eZDirection], eYDirection, M_lim, K_lim, L_DIMS);
 
-			sendVel[toRank].push_back(objman->iBody[ib]._Owner->rho(idx[eXDirection], idx[eYDirection], idx[eZDirection], M_lim, K_lim) *
-									  objman->iBody[ib]._Owner->u(idx[eXDirection], idx[eYDirection], idx[eZDirection], eZDirection, M_lim, K_lim, L_DIMS));
+			sendList.buffer[pos + 3] = objman->iBody[ib]._Owner->rho(idx[eXDirection], idx[eYDirection], idx[eZDirection], M_lim, K_lim) *
+									   objman->iBody[ib]._Owner->u(idx[eXDirection], idx[eYDirection], idx[eZDirection], eZDirection, M_lim, K_lim, L_DIMS);
 #endif
 		}
 	}
 
-	// Now send the values
-	std::vector<MPI_Request> sendRequests;
-	for (int toRank = 0; toRank < num_ranks; toRank++) {
-
-		// Check if current rank needs to send stuff to rank toRank
-		if (sendVel[toRank].size() > 0) {
-			sendRequests.push_back(MPI_REQUEST_NULL);
-			MPI_Isend(&sendVel[toRank].front(), static_cast<int>(sendVel[toRank].size()),
-				MPI_DOUBLE, toRank, my_rank, world_comm, &sendRequests.back());
-		}
-	}
-
-	// Get receive sizes from each rank
-	std::vector<int> bufferSize(num_ranks, 0);
-	for (int i = 0; i < supportCommMarkerSide[level].size(); i++) {
-		if (objman->iBody[objman->bodyIDToIdx[supportCommMarkerSide[level][i].bodyID]]._Owner->level == level)
-			bufferSize[supportCommMarkerSide[level][i].rankComm] += L_DIMS + 1;
-	}
-
-	// Now receive the velocity values
-	recvVel.resize(num_ranks, std::vector<double>(0));
-	for (int fromRank = 0; fromRank < num_ranks; fromRank++) {
-
-		// If there is data to receive from rank fromRank
-		if (bufferSize[fromRank] > 0) {
-			recvVel[fromRank].resize(bufferSize[fromRank]);
-			MPI_Recv(&recvVel[fromRank].front(), static_cast<int>(recvVel[fromRank].size()),
-				MPI_DOUBLE, fromRank, fromRank, world_comm, MPI_STATUS_IGNORE);
-		}
-	}
-
-	// If sending any messages then wait for request status
-	MPI_Waitall(static_cast<int>(sendRequests.size()), &sendRequests.front(), MPI_STATUS_IGNORE);
+	// Exchange with neighbours
+	mpi_ibmExchange(sendList, supportNbrMarkerSide[level], L_DIMS + 1, eIBTagInterpolate);
 }
 
 
@@ -211,71 +199,36 @@ void MpiManager::mpi_epsilonCommScatter(int level) {
 	ObjectManager *objman = ObjectManager::getInstance();
 
 	// Declare send buffer
-	std::vector<std::vector<double>> sendBuffer(num_ranks, std::vector<double>(0));
+	IBCommNeighbourList &sendList = markerNbrOwnerSide[level];
+	sendList.buffer.resize(sendList.displs.back());
 
-	// Pack and send the other epsilon values
-	int toRank, ib, markerID;
+	// Pack the epsilon values
+	int ib, markerID;
 	for (int i = 0; i < markerCommOwnerSide[level].size(); i++) {
 
 		// Get ID info
-		toRank = markerCommOwnerSide[level][i].rankComm;
 		ib = objman->bodyIDToIdx[markerCommOwnerSide[level][i].bodyID];
 		markerID = markerCommOwnerSide[level][i].markerID;
 
 		// Insert into buffer
-		sendBuffer[toRank].push_back(objman->iBody[ib].markers[markerID].epsilon);
+		sendList.buffer[sendList.entryDispl[i]] = objman->iBody[ib].markers[markerID].epsilon;
 	}
 
-	// Loop through and post send if there is data
-	std::vector<MPI_Request> sendRequests;
-	for (int toRank = 0; toRank < num_ranks; toRank++) {
-		if (sendBuffer[toRank].size() > 0) {
-			sendRequests.push_back(MPI_REQUEST_NULL);
-			MPI_Isend(&sendBuffer[toRank].front(), static_cast<int>(sendBuffer[toRank].size()),
-				MPI_DOUBLE, toRank, my_rank, world_comm, &sendRequests.back());
-		}
-	}
-
-	// Set up receive buffer sizes
-	std::vector<int> bufferSize(num_ranks, 0);
-
-	// Size the receive buffer
-	for (int i = 0; i < markerCommMarkerSide[level].size(); i++)
-		bufferSize[markerCommMarkerSide[level][i].rankComm]++;
-
-	// Declare receive buffer
-	std::vector<std::vector<double>> recvBuffer(num_ranks, std::vector<double>(0));
-
-	// Loop through and receive if there is data
-	for (int fromRank = 0; fromRank < num_ranks; fromRank++) {
-
-		// Only do if there is information to receive
-		if (bufferSize[fromRank] > 0) {
-			recvBuffer[fromRank].resize(bufferSize[fromRank]);
-			MPI_Recv(&recvBuffer[fromRank].front(), static_cast<int>(recvBuffer[fromRank].size()),
-				MPI_DOUBLE, fromRank, fromRank, world_comm, MPI_STATUS_IGNORE);
-		}
-	}
-
-	// Create idx vector
-	std::vector<int> idx(num_ranks, 0);
+	// Exchange with neighbours
+	IBCommNeighbourList &recvList = markerNbrMarkerSide[level];
+	mpi_ibmExchange(sendList, recvList, 1, eIBTagEpsilonScatter);
 
 	// Now unpack into epsilon values
-	int fromRank, markerIdx;
+	int markerIdx;
 	for (int i = 0; i < markerCommMarkerSide[level].size(); i++) {
 
 		// Get ID info
-		fromRank = markerCommMarkerSide[level][i].rankComm;
 		ib = objman->bodyIDToIdx[markerCommMarkerSide[level][i].bodyID];
 		markerIdx = markerCommMarkerSide[level][i].markerIdx;
 
 		// Put into epsilon
-		objman->iBody[ib].markers[markerIdx].epsilon = recvBuffer[fromRank][idx[fromRank]];
-		idx[fromRank]++;
+		objman->iBody[ib].markers[markerIdx].epsilon = recvList.buffer[recvList.entryDispl[i]];
 	}
-
-	// If sending any messages then wait for request status
-	MPI_Waitall(static_cast<int>(sendRequests.size()), &sendRequests.front(), MPI_STATUS_IGNORE);
 }
 
 
@@ -289,68 +242,43 @@ void MpiManager::mpi_epsilonCommGather(int level) {
 	ObjectManager *objman = ObjectManager::getInstance();
 
 	// Declare send buffer
-	std::vector<std::vector<double>> sendBuffer(num_ranks, std::vector<double>(0));
+	IBCommNeighbourList &sendList = markerSuppNbrMarkerSide[level];
+	sendList.buffer.resize(sendList.displs.back() * (L_DIMS + 1));
 
 	// Pack the data to send
-	int toRank, ib, m;
+	int ib, m, pos;
 	for (int i = 0; i < markerCommMarkerSide[level].size(); i++) {
 
 		// Get ID info
-		toRank = markerCommMarkerSide[level][i].rankComm;
 		ib = objman->bodyIDToIdx[markerCommMarkerSide[level][i].bodyID];
 		m = markerCommMarkerSide[level][i].markerIdx;
+		pos = sendList.entryDispl[i] * (L_DIMS + 1);
 
 		// Pack support data
 		for (int s = 0; s < objman->iBody[ib].markers[m].deltaval.size(); s++) {
-			sendBuffer[toRank].push_back(objman->iBody[ib].markers[m].supp_x[s]);
-			sendBuffer[toRank].push_back(objman->iBody[ib].markers[m].supp_y[s]);
+			sendList.buffer[pos] = objman->iBody[ib].markers[m].supp_x[s];
+			sendList.buffer[pos + 1] = objman->iBody[ib].markers[m].supp_y[s];
 #if (L_DIMS == 3)
-			sendBuffer[toRank].push_back(objman->iBody[ib].markers[m].supp_z[s]);
+			sendList.buffer[pos + 2] = objman->iBody[ib].markers[m].supp_z[s];
 #endif
-			sendBuffer[toRank].push_back(objman->iBody[ib].markers[m].deltaval[s]);
+			sendList.buffer[pos + L_DIMS] = objman->iBody[ib].markers[m].deltaval[s];
+			pos += L_DIMS + 1;
 		}
 	}
 
-	// Now loop through send buffer and send to appropriate ranks
-	std::vector<MPI_Request> sendRequests;
-	for (int toRank = 0; toRank < num_ranks; toRank++) {
-		if (sendBuffer[toRank].size() > 0) {
-			sendRequests.push_back(MPI_REQUEST_NULL);
-			MPI_Isend(&sendBuffer[toRank].front(), static_cast<int>(sendBuffer[toRank].size()), MPI_DOUBLE, toRank, my_rank, world_comm, &sendRequests.back());
-		}
-	}
-
-	// Get buffer sizes
-	std::vector<int> bufferSize(num_ranks, 0);
-	for (int i = 0; i < markerCommOwnerSide[level].size(); i++)
-		bufferSize[markerCommOwnerSide[level][i].rankComm] += markerCommOwnerSide[level][i].nSupportSites * (L_DIMS + 1);
-
-	// Now create receive buffer
-	std::vector<std::vector<double>> recvBuffer(num_ranks, std::vector<double>(0));
-
-	// Now loop through and receive the buffer
-	for (int fromRank = 0; fromRank < num_ranks; fromRank++) {
-
-		// Only do if there is information to receive
-		if (bufferSize[fromRank] > 0) {
-			recvBuffer[fromRank].resize(bufferSize[fromRank]);
-			MPI_Recv(&recvBuffer[fromRank].front(), static_cast<int>(recvBuffer[fromRank].size()),
-				MPI_DOUBLE, fromRank, fromRank, world_comm, MPI_STATUS_IGNORE);
-		}
-	}
-
-	// Index vector for looping through recvBuffer
-	std::vector<int> idx(num_ranks, 0);
+	// Exchange with neighbours
+	IBCommNeighbourList &recvList = markerSuppNbrOwnerSide[level];
+	mpi_ibmExchange(sendList, recvList, L_DIMS + 1, eIBTagEpsilonGather);
 
 	// Now unpack
-	int fromRank, nSupports;
+	int nSupports;
 	for (int i = 0; i < markerCommOwnerSide[level].size(); i++) {
 
 		// Get ID info
-		fromRank = markerCommOwnerSide[level][i].rankComm;
 		ib = objman->bodyIDToIdx[markerCommOwnerSide[level][i].bodyID];
 		m = markerCommOwnerSide[level][i].markerID;
 		nSupports = markerCommOwnerSide[level][i].nSupportSites;
+		pos = recvList.entryDispl[i] * (L_DIMS + 1);
 
 		// Clear the vectors
 		objman->iBody[ib].markers[m].supp_x.resize(nSupports, 0.0);
@@ -360,364 +288,162 @@ void MpiManager::mpi_epsilonCommGather(int level) {
 
 		// Unpack into iBody
 		for (int s = 0; s < nSupports; s++) {
-			objman->iBody[ib].markers[m].supp_x[s] = recvBuffer[fromRank][idx[fromRank]];
-			objman->iBody[ib].markers[m].supp_y[s] = recvBuffer[fromRank][idx[fromRank]+1];
+			objman->iBody[ib].markers[m].supp_x[s] = recvList.buffer[pos];
+			objman->iBody[ib].markers[m].supp_y[s] = recvList.buffer[pos + 1];
 #if (L_DIMS == 3)
-			objman->iBody[ib].markers[m].supp_z[s] = recvBuffer[fromRank][idx[fromRank]+2];
+			objman->iBody[ib].markers[m].supp_z[s] = recvList.buffer[pos + 2];
 #endif
-			idx[fromRank] += L_DIMS;
 
 			// Get delta values
-			objman->iBody[ib].markers[m].deltaval[s] = recvBuffer[fromRank][idx[fromRank]];
-			idx[fromRank]++;
+			objman->iBody[ib].markers[m].deltaval[s] = recvList.buffer[pos + L_DIMS];
+			pos += L_DIMS + 1;
 		}
 	}
-
-	// If sending any messages then wait for request status
-	MPI_Waitall(static_cast<int>(sendRequests.size()), &sendRequests.front(), MPI_STATUS_IGNORE);
 }
 
 
 // *****************************************************************************
-///	\brief	Do communication required to gather values for universal epsilon calculation
+///	\brief	Exchange the markers needed by neighbouring ranks for the universal epsilon calculation
 ///
-///	\param	level			current grid level.
-///	\param	rootRank		rank to which data should be passed.
-///	\param	iBodyTmp		temporary IBBody which is used for epsilon calculation.
-void MpiManager::mpi_uniEpsilonCommGather(int level, int rootRank, IBBody &iBodyTmp) {
-
-	// Get object manager instance
-	ObjectManager *objman = ObjectManager::getInstance();
+///			Each rank shares the bounding box of its markers and then sends 
+///			the data of every local marker lying within reach of another 
+///			rank's box to that rank. The neighbour lists are kept so that the
+///			ghost values can be refreshed during the solve.
+///
+///	\param	level			current grid level
+///	\param	localData		position, dilation and ds of each marker on this rank
+///	\param	reach			largest distance over which two markers interact
+///	\param	ghostData		position, dilation and ds of each ghost marker
+void MpiManager::mpi_uniEpsilonBuildGhosts(int level, const std::vector<double> &localData, double reach, std::vector<double> &ghostData) {
 
 	// Get ranks which exist on this level
 	std::vector<int> lev2glob = mpi_mapRankLevelToWorld(level);
-	std::vector<int> glob2lev = mpi_mapRankWorldToLevel(level);
-
-	// Get root ID in this communicator
-	int rootRankLev = glob2lev[rootRank];
-
-	// Initialise values
-	int nMarkersOnThisRank = 0;
-	std::vector<int> deltasPerMarkerOnThisRank;
-
-	// Get how many markers and supports exist on each rank
-	for (int ib = 0; ib < objman->iBody.size(); ib++) {
-
-		// If this body is on this level
-		if (objman->iBody[ib].level == level) {
-
-			// Number of markers on this rank
-			nMarkersOnThisRank += static_cast<int>(objman->iBody[ib].validMarkers.size());
-
-			// Loop through markers and get number of deltas
-			for (auto m : objman->iBody[ib].validMarkers)
-				deltasPerMarkerOnThisRank.push_back(static_cast<int>(objman->iBody[ib].markers[m].deltaval.size()));
-		}
-	}
-
-	// Set receive buffer for how many markers on each rank
-	std::vector<int> nMarkersOnEachRank;
-	std::vector<int> nMarkersOnEachRankLev;
-	if (my_rank == rootRank) {
-		nMarkersOnEachRank.resize(num_ranks, 0);
-		nMarkersOnEachRankLev.resize(lev2glob.size(), 0);
-	}
-
-	// Perform gather so root rank knows how many markers on each rank
-	MPI_Gather(&nMarkersOnThisRank, 1, MPI_INT, &nMarkersOnEachRankLev.front(), 1, MPI_INT, rootRankLev, lev_comm[level]);
-
-	// Insert into full vector
-	if (my_rank == rootRank) {
-		for (int levRank = 0; levRank < lev2glob.size(); levRank++)
-			nMarkersOnEachRank[lev2glob[levRank]] = nMarkersOnEachRankLev[levRank];
-	}
-
-	// Get number of markers in whole system
-	int nSystemMarkers = std::accumulate(nMarkersOnEachRankLev.begin(), nMarkersOnEachRankLev.end(), 0);
-
-	// Create result and displacement arrays
-	std::vector<int> deltasPerMarkerOnEachRank;
-	std::vector<int> markerDisps;
-
-	// Root rank resize result and displacement arrays
-	if (my_rank == rootRank) {
-
-		// Resize result vector
-		deltasPerMarkerOnEachRank.resize(nSystemMarkers);
-		markerDisps.resize(lev2glob.size());
-
-		// Calculate block displacements
-		for (int i = 1; i < lev2glob.size(); i++)
-			markerDisps[i] = std::accumulate(nMarkersOnEachRankLev.begin(), nMarkersOnEachRankLev.begin()+i, 0);
-	}
-
-	// Gather so root rank knows how many support sites each markers has
-	MPI_Gatherv(&deltasPerMarkerOnThisRank.front(), nMarkersOnThisRank, MPI_INT, &deltasPerMarkerOnEachRank.front(), &nMarkersOnEachRankLev.front(), &markerDisps.front(), MPI_INT, rootRankLev, lev_comm[level]);
-
-	// Declare receive buffer vectors
-	std::vector<int> recvBufferSizes;
-	std::vector<int> recvBufferDisps;
-	std::vector<double> recvBuffer;
-
-	// Now create receive buffer, buffer size and buffer displacements
-	if (my_rank == rootRank) {
-
-		// Resize for number of ranks
-		recvBufferSizes.resize(lev2glob.size(), 0);
-		recvBufferDisps.resize(lev2glob.size(), 0);
-
-		// Counter
-		int count = 0;
-
-		// Loop through all ranks and sort out receive buffer
-		for (int fromRank = 0; fromRank < lev2glob.size(); fromRank++) {
-
-			// Loop through all markers which exist on this rank
-			for (int m = 0; m < nMarkersOnEachRankLev[fromRank]; m++) {
-
-				// Add contribution to buffer size
-				recvBufferSizes[fromRank] += (L_DIMS + 3) + deltasPerMarkerOnEachRank[count] * (L_DIMS + 1);
-
-				// Increment counter
-				count++;
+	int nLevRanks = static_cast<int>(lev2glob.size());
+
+	// Number of values per marker
+	const int stride = L_DIMS + 2;
+	int nLocal = static_cast<int>(localData.size()) / stride;
+
+	// Bounding box of the markers on this rank (empty if min > max)
+	std::vector<double> box(2 * L_DIMS);
+	for (int d = 0; d < L_DIMS; d++) {
+		box[d] = std::numeric_limits<double>::max();
+		box[L_DIMS + d] = -std::numeric_limits<double>::max();
+	}
+	for (int m = 0; m < nLocal; m++) {
+		for (int d = 0; d < L_DIMS; d++) {
+			box[d] = std::min(box[d], localData[m * stride + d]);
+			box[L_DIMS + d] = std::max(box[L_DIMS + d], localData[m * stride + d]);
+		}
+	}
+
+	// Share the boxes with all ranks on this level
+	std::vector<double> boxes(2 * L_DIMS * nLevRanks);
+	MPI_Allgather(&box.front(), 2 * L_DIMS, MPI_DOUBLE, &boxes.front(), 2 * L_DIMS, MPI_DOUBLE, lev_comm[level]);
+
+	// Find which local markers each rank needs
+	std::vector<int> entryRank;
+	std::vector<int> nSendLev(nLevRanks, 0);
+	uniEpsSendIdx.clear();
+	for (int levRank = 0; levRank < nLevRanks; levRank++) {
+		if (lev2glob[levRank] == my_rank)
+			continue;
+
+		const double *other = &boxes[2 * L_DIMS * levRank];
+		for (int m = 0; m < nLocal; m++) {
+			bool bNear = true;
+			for (int d = 0; d < L_DIMS; d++) {
+				if (localData[m * stride + d] < other[d] - reach || localData[m * stride + d] > other[L_DIMS + d] + reach)
+					bNear = false;
 			}
-		}
-
-		// Calculate block displacements
-		for (int i = 1; i < lev2glob.size(); i++)
-			recvBufferDisps[i] = std::accumulate(recvBufferSizes.begin(), recvBufferSizes.begin()+i, 0);
-
-		// Resize receive buffer
-		recvBuffer.resize(std::accumulate(recvBufferSizes.begin(), recvBufferSizes.end(), 0), 0.0);
-	}
-
-	// Declare send buffer vector
-	std::vector<double> sendBuffer;
-
-	// Now pack data into send buffer
-	for (int ib = 0; ib < objman->iBody.size(); ib++) {
-
-		// If this body is on this level
-		if (objman->iBody[ib].level == level) {
-
-			// Loop through valid markers on this body
-			for (auto m : objman->iBody[ib].validMarkers) {
-
-				// Pack position first
-				sendBuffer.push_back(objman->iBody[ib].markers[m].position[eXDirection]);
-				sendBuffer.push_back(objman->iBody[ib].markers[m].position[eYDirection]);
-#if (L_DIMS == 3)
-				sendBuffer.push_back(objman->iBody[ib].markers[m].position[eZDirection]);
-#endif
-				sendBuffer.push_back(objman->iBody[ib].markers[m].local_area);
-				sendBuffer.push_back(objman->iBody[ib].markers[m].dilation);
-				sendBuffer.push_back(objman->iBody[ib].markers[m].ds);
-
-				// Now pack the support site data
-				for (int s = 0; s < objman->iBody[ib].markers[m].deltaval.size(); s++) {
-					sendBuffer.push_back(objman->iBody[ib].markers[m].supp_x[s]);
-					sendBuffer.push_back(objman->iBody[ib].markers[m].supp_y[s]);
-#if (L_DIMS == 3)
-					sendBuffer.push_back(objman->iBody[ib].markers[m].supp_z[s]);
-#endif
-					sendBuffer.push_back(objman->iBody[ib].markers[m].deltaval[s]);
-				}
+			if (bNear) {
+				entryRank.push_back(lev2glob[levRank]);
+				uniEpsSendIdx.push_back(m);
+				nSendLev[levRank]++;
 			}
 		}
 	}
+	uniEpsNbrSend.build(entryRank, std::vector<int>(entryRank.size(), 1));
 
-	// Now send all data to root
-	MPI_Gatherv(&sendBuffer.front(), static_cast<int>(sendBuffer.size()),
-		MPI_DOUBLE, &recvBuffer.front(), &recvBufferSizes.front(), &recvBufferDisps.front(),
-		MPI_DOUBLE, rootRankLev, lev_comm[level]);
-
-	// Set global values
-	iBodyTmp.owningRank = rootRank;
-	iBodyTmp.level = level;
-	iBodyTmp.dh = objman->_Grids->dh / pow(2.0, level);
-
-	// Unpack receive buffer
-	if (my_rank == rootRank) {
-
-		// Resize number of markers
-		iBodyTmp.markers.resize(nSystemMarkers);
-
-		// Counter
-		int count = 0;
-
-		// Marker ID
-		int m = 0;
-
-		// Now loop through all markers
-		for (int rank = 0; rank < num_ranks; rank++) {
-			for (int marker = 0; marker < nMarkersOnEachRank[rank]; marker++) {
-
-				// Get owning rank of marker (need this for the scatter later)
-				iBodyTmp.markers[m].owningRank = rank;
+	// Tell each rank how many ghosts to expect
+	std::vector<int> nRecvLev(nLevRanks, 0);
+	MPI_Alltoall(&nSendLev.front(), 1, MPI_INT, &nRecvLev.front(), 1, MPI_INT, lev_comm[level]);
+	entryRank.clear();
+	for (int levRank = 0; levRank < nLevRanks; levRank++)
+		entryRank.insert(entryRank.end(), nRecvLev[levRank], lev2glob[levRank]);
+	uniEpsNbrRecv.build(entryRank, std::vector<int>(entryRank.size(), 1));
 
-				// Pack position
-				for (int d = 0; d < L_DIMS; d++)
-					iBodyTmp.markers[m].position[d] = recvBuffer[count+d];
-
-				// Increment
-				count += L_DIMS;
-
-				// Pack area and dilation
-				iBodyTmp.markers[m].local_area = recvBuffer[count]; count++;
-				iBodyTmp.markers[m].dilation = recvBuffer[count]; count++;
-				iBodyTmp.markers[m].ds = recvBuffer[count]; count++;
+	// Pack and exchange the marker data
+	uniEpsNbrSend.buffer.resize(uniEpsNbrSend.displs.back() * stride);
+	for (size_t e = 0; e < uniEpsSendIdx.size(); e++) {
+		for (int v = 0; v < stride; v++)
+			uniEpsNbrSend.buffer[uniEpsNbrSend.entryDispl[e] * stride + v] = localData[uniEpsSendIdx[e] * stride + v];
+	}
+	mpi_ibmExchange(uniEpsNbrSend, uniEpsNbrRecv, stride, eIBTagUniEpsilonGhosts);
+	ghostData = uniEpsNbrRecv.buffer;
+}
 
-				// Now pack support data
-				for (int s = 0; s < deltasPerMarkerOnEachRank[m]; s++) {
-					iBodyTmp.markers[m].supp_x.push_back(recvBuffer[count]); count++;
-					iBodyTmp.markers[m].supp_y.push_back(recvBuffer[count]); count++;
-#if (L_DIMS == 3)
-					iBodyTmp.markers[m].supp_z.push_back(recvBuffer[count]); count++;
-#endif
-					iBodyTmp.markers[m].deltaval.push_back(recvBuffer[count]); count++;
-				}
 
-				// Increment m
-				m++;
-			}
-		}
-	}
+// *****************************************************************************
+///	\brief	Refresh the ghost values of a vector in the universal epsilon solve
+///
+///			Uses the neighbour lists built by mpi_uniEpsilonBuildGhosts.
+///
+///	\param	values			local values followed by the ghost values
+///	\param	nLocal			number of markers on this rank
+void MpiManager::mpi_uniEpsilonUpdateGhosts(std::vector<double> &values, int nLocal) {
+
+	// Pack local values
+	uniEpsNbrSend.buffer.resize(uniEpsNbrSend.displs.back());
+	for (size_t e = 0; e < uniEpsSendIdx.size(); e++)
+		uniEpsNbrSend.buffer[uniEpsNbrSend.entryDispl[e]] = values[uniEpsSendIdx[e]];
+
+	// Exchange and copy in ghost values
+	mpi_ibmExchange(uniEpsNbrSend, uniEpsNbrRecv, 1, eIBTagUniEpsilonHalo);
+	std::copy(uniEpsNbrRecv.buffer.begin(), uniEpsNbrRecv.buffer.end(), values.begin() + nLocal);
 }
 
 
 // *****************************************************************************
-///	\brief	Do communication required to send values after universal epsilon calculation
+///	\brief	Return epsilon values from the ranks holding the markers to the body owner
 ///
-///	\param	level			current grid level.
-///	\param	rootRank		root rank which did the calculation.
-///	\param	iBodyTmp		temporary IBBody which is used for epsilon calculation
-void MpiManager::mpi_uniEpsilonCommScatter(int level, int rootRank, IBBody &iBodyTmp) {
+///	\param	level			current grid level
+void MpiManager::mpi_epsilonCommReturn(int level) {
 
 	// Get object manager instance
 	ObjectManager *objman = ObjectManager::getInstance();
 
-	// Get ranks which exist on this level
-	std::vector<int> lev2glob = mpi_mapRankLevelToWorld(level);
-	std::vector<int> glob2lev = mpi_mapRankWorldToLevel(level);
-
-	// Get root ID in this communicator
-	int rootRankLev = glob2lev[rootRank];
-
-	// Declare send buffer vectors
-	std::vector<int> sendBufferSizes;
-	std::vector<int> sendBufferDisps;
-	std::vector<double> sendBuffer;
-
-	// Root rank pack data into send buffer and sort sizes
-	if (my_rank == rootRank) {
-
-		// Set sizes
-		sendBufferSizes.resize(lev2glob.size(), 0);
-		sendBufferDisps.resize(lev2glob.size(), 0);
-
-		// Loop through pack epsilon and insert buffer sizes for each rank
-		for (int m = 0; m < iBodyTmp.markers.size(); m++) {
-			sendBuffer.push_back(iBodyTmp.markers[m].epsilon);
-			sendBufferSizes[glob2lev[iBodyTmp.markers[m].owningRank]]++;
-		}
-
-		// Calculate block displacements
-		for (int i = 1; i < static_cast<int>(lev2glob.size()); i++)
-			sendBufferDisps[i] = std::accumulate(sendBufferSizes.begin(), sendBufferSizes.begin()+i, 0);
-	}
-
-	// Get how many markers and supports exist on each rank
-	int nMarkersOnThisRank = 0;
-	for (int ib = 0; ib < objman->iBody.size(); ib++) {
-		if (objman->iBody[ib].level == level) {
-			nMarkersOnThisRank += static_cast<int>(objman->iBody[ib].validMarkers.size());
-		}
-	}
-
-
-	// Create receive buffer
-	std::vector<double> recvBuffer(nMarkersOnThisRank, 0.0);
-
-	// Scatter the epsilon values to the correct rank
-	MPI_Scatterv(&sendBuffer.front(), &sendBufferSizes.front(), &sendBufferDisps.front(), MPI_DOUBLE, &recvBuffer.front(), nMarkersOnThisRank, MPI_DOUBLE, rootRankLev, lev_comm[level]);
-
-	// Now unpack
-	int count = 0;
-	for (int ib = 0; ib < objman->iBody.size(); ib++) {
-		if (objman->iBody[ib].level == level) {
-			for (auto m : objman->iBody[ib].validMarkers) {
-				objman->iBody[ib].markers[m].epsilon = recvBuffer[count];
-				count++;
-			}
-		}
-	}
-
-	// Update owning rank's epsilon values
-	std::vector<std::vector<double>> sendEpsBuffer(num_ranks, std::vector<double>(0));
+	// Declare send buffer
+	IBCommNeighbourList &sendList = markerNbrMarkerSide[level];
+	sendList.buffer.resize(sendList.displs.back());
 
-	// Pack and send the other epsilon values
-	int toRank, ib, markerIdx;
+	// Pack the epsilon values
+	int ib, markerIdx;
 	for (int i = 0; i < markerCommMarkerSide[level].size(); i++) {
 
 		// Get ID info
-		toRank = markerCommMarkerSide[level][i].rankComm;
 		ib = objman->bodyIDToIdx[markerCommMarkerSide[level][i].bodyID];
 		markerIdx = markerCommMarkerSide[level][i].markerIdx;
 
 		// Insert into buffer
-		sendEpsBuffer[toRank].push_back(objman->iBody[ib].markers[markerIdx].epsilon);
+		sendList.buffer[sendList.entryDispl[i]] = objman->iBody[ib].markers[markerIdx].epsilon;
 	}
 
-	// Loop through and post send if there is data
-	std::vector<MPI_Request> sendRequests;
-	for (int toRank = 0; toRank < num_ranks; toRank++) {
-		if (sendEpsBuffer[toRank].size() > 0) {
-			sendRequests.push_back(MPI_REQUEST_NULL);
-			MPI_Isend(&sendEpsBuffer[toRank].front(), static_cast<int>(sendEpsBuffer[toRank].size()),
-				MPI_DOUBLE, toRank, my_rank, world_comm, &sendRequests.back());
-		}
-	}
-
-	// Set up receive buffer sizes
-	std::vector<int> bufferSize(num_ranks, 0);
-
-	// Size the receive buffer
-	for (int i = 0; i < markerCommOwnerSide[level].size(); i++)
-		bufferSize[markerCommOwnerSide[level][i].rankComm]++;
-
-	// Declare receive buffer
-	std::vector<std::vector<double>> recvEpsBuffer(num_ranks, std::vector<double>(0));
-
-	// Loop through and receive if there is data
-	for (int fromRank = 0; fromRank < num_ranks; fromRank++) {
-
-		// Only do if there is information to receive
-		if (bufferSize[fromRank] > 0) {
-			recvEpsBuffer[fromRank].resize(bufferSize[fromRank]);
-			MPI_Recv(&recvEpsBuffer[fromRank].front(), static_cast<int>(recvEpsBuffer[fromRank].size()),
-				MPI_DOUBLE, fromRank, fromRank, world_comm, MPI_STATUS_IGNORE);
-		}
-	}
-
-	// Create idx vector
-	std::vector<int> idx(num_ranks, 0);
+	// Exchange with neighbours
+	IBCommNeighbourList &recvList = markerNbrOwnerSide[level];
+	mpi_ibmExchange(sendList, recvList, 1, eIBTagEpsilonReturn);
 
 	// Now unpack into epsilon values
-	int fromRank, markerID;
+	int markerID;
 	for (int i = 0; i < markerCommOwnerSide[level].size(); i++) {
 
 		// Get ID info
-		fromRank = markerCommOwnerSide[level][i].rankComm;
 		ib = objman->bodyIDToIdx[markerCommOwnerSide[level][i].bodyID];
 		markerID = markerCommOwnerSide[level][i].markerID;
 
 		// Put into epsilon
-		objman->iBody[ib].markers[markerID].epsilon = recvEpsBuffer[fromRank][idx[fromRank]];
-		idx[fromRank]++;
+		objman->iBody[ib].markers[markerID].epsilon = recvList.buffer[recvList.entryDispl[i]];
 	}
-
-	// If sending any messages then wait for request status
-	MPI_Waitall(static_cast<int>(sendRequests.size()), &sendRequests.front(), MPI_STATUS_IGNORE);
 }
 
 
@@ -798,6 +524,26 @@ void MpiManager::mpi_buildMarkerComms(int level) {
 		idx[markerCommOwnerSide[level][i].rankComm]++;
 	}
 
+	// Build the neighbour lists for the owner side
+	std::vector<int> entryRank(markerCommOwnerSide[level].size());
+	std::vector<int> entrySize(markerCommOwnerSide[level].size());
+	for (int i = 0; i < markerCommOwnerSide[level].size(); i++) {
+		entryRank[i] = markerCommOwnerSide[level][i].rankComm;
+		entrySize[i] = markerCommOwnerSide[level][i].nSupportSites;
+	}
+	markerSuppNbrOwnerSide[level].build(entryRank, entrySize);
+	markerNbrOwnerSide[level].build(entryRank, std::vector<int>(entryRank.size(), 1));
+
+	// Build the neighbour lists for the marker side
+	entryRank.resize(markerCommMarkerSide[level].size());
+	entrySize.resize(markerCommMarkerSide[level].size());
+	for (int i = 0; i < markerCommMarkerSide[level].size(); i++) {
+		entryRank[i] = markerCommMarkerSide[level][i].rankComm;
+		entrySize[i] = static_cast<int>(objman->iBody[objman->bodyIDToIdx[markerCommMarkerSide[level][i].bodyID]].markers[markerCommMarkerSide[level][i].markerIdx].deltaval.size());
+	}
+	markerSuppNbrMarkerSide[level].build(entryRank, entrySize);
+	markerNbrMarkerSide[level].build(entryRank, std::vector<int>(entryRank.size(), 1));
+
 	// If sending any messages then wait for request status
 	MPI_Waitall(static_cast<int>(sendRequests.size()), &sendRequests.front(), MPI_STATUS_IGNORE);
 }
@@ -934,6 +680,16 @@ void MpiManager::mpi_buildSupportComms(int level) {
 		}
 	}
 
+	// Build the neighbour lists for both sides
+	std::vector<int> entryRank(supportCommMarkerSide[level].size());
+	for (int i = 0; i < supportCommMarkerSide[level].size(); i++)
+		entryRank[i] = supportCommMarkerSide[level][i].rankComm;
+	supportNbrMarkerSide[level].build(entryRank, std::vector<int>(entryRank.size(), 1));
+	entryRank.resize(supportCommSupportSide[level].size());
+	for (int i = 0; i < supportCommSupportSide[level].size(); i++)
+		entryRank[i] = supportCommSupportSide[level][i].rankComm;
+	supportNbrSupportSide[level].build(entryRank, std::vector<int>(entryRank.size(), 1));
+
 	// If sending any messages then wait for request status
 	MPI_Waitall(static_cast<int>(sendRequests.size()), &sendRequests.front(), MPI_STATUS_IGNORE);
 }
@@ -949,76 +705,41 @@ void MpiManager::mpi_dsCommScatter(int level) {
 	ObjectManager *objman = ObjectManager::getInstance();
 
 	// Declare send buffer
-	std::vector<std::vector<double>> sendBuffer(num_ranks, std::vector<double>(0));
+	IBCommNeighbourList &sendList = markerNbrOwnerSide[level];
+	sendList.buffer.resize(sendList.displs.back());
 
-	// Pack and send the other epsilon values
-	int toRank, ib, markerID;
+	// Pack the ds values
+	int ib, markerID;
 	for (int i = 0; i < markerCommOwnerSide[level].size(); i++) {
 
 		// Get ID info
-		toRank = markerCommOwnerSide[level][i].rankComm;
 		ib = objman->bodyIDToIdx[markerCommOwnerSide[level][i].bodyID];
 		markerID = markerCommOwnerSide[level][i].markerID;
 
 		// Insert into buffer
-		sendBuffer[toRank].push_back(objman->iBody[ib].markers[markerID].ds);
-	}
-
-	// Loop through and post send if there is data
-	std::vector<MPI_Request> sendRequests;
-	for (int toRank = 0; toRank < num_ranks; toRank++) {
-		if (sendBuffer[toRank].size() > 0) {
-			sendRequests.push_back(MPI_REQUEST_NULL);
-			MPI_Isend(&sendBuffer[toRank].front(), static_cast<int>(sendBuffer[toRank].size()),
-				MPI_DOUBLE, toRank, my_rank, world_comm, &sendRequests.back());
-		}
-	}
-
-	// Set up receive buffer sizes
-	std::vector<int> bufferSize(num_ranks, 0);
-
-	// Size the receive buffer
-	for (int i = 0; i < markerCommMarkerSide[level].size(); i++)
-		bufferSize[markerCommMarkerSide[level][i].rankComm]++;
-
-	// Declare receive buffer
-	std::vector<std::vector<double>> recvBuffer(num_ranks, std::vector<double>(0));
-
-	// Loop through and receive if there is data
-	for (int fromRank = 0; fromRank < num_ranks; fromRank++) {
-
-		// Only do if there is information to receive
-		if (bufferSize[fromRank] > 0) {
-			recvBuffer[fromRank].resize(bufferSize[fromRank]);
-			MPI_Recv(&recvBuffer[fromRank].front(), static_cast<int>(recvBuffer[fromRank].size()),
-				MPI_DOUBLE, fromRank, fromRank, world_comm, MPI_STATUS_IGNORE);
-		}
+		sendList.buffer[sendList.entryDispl[i]] = objman->iBody[ib].markers[markerID].ds;
 	}
 
-	// Create idx vector
-	std::vector<int> idx(num_ranks, 0);
+	// Exchange with neighbours
+	IBCommNeighbourList &recvList = markerNbrMarkerSide[level];
+	mpi_ibmExchange(sendList, recvList, 1, eIBTagDsScatter);
 
-	// Now unpack into epsilon values
-	int fromRank, markerIdx;
+	// Now unpack into ds values
+	int markerIdx;
 	for (int i = 0; i < markerCommMarkerSide[level].size(); i++) {
 
 		// Get ID info
-		fromRank = markerCommMarkerSide[level][i].rankComm;
 		ib = objman->bodyIDToIdx[markerCommMarkerSide[level][i].bodyID];
 		markerIdx = markerCommMarkerSide[level][i].markerIdx;
 
-		// Put into epsilon
-		objman->iBody[ib].markers[markerIdx].ds = recvBuffer[fromRank][idx[fromRank]];
-		idx[fromRank]++;
+		// Put into ds
+		objman->iBody[ib].markers[markerIdx].ds = recvList.buffer[recvList.entryDispl[i]];
 	}
-
-	// If sending any messages then wait for request status
-	MPI_Waitall(static_cast<int>(sendRequests.size()), &sendRequests.front(), MPI_STATUS_IGNORE);
 }
 
 
 // *****************************************************************************
-///	\brief	Gather information required for sorting the point cloud marker IDs
+///	\brief	Gather the renumbered point cloud markers on the owning rank
 ///
 ///	\param	iBody					pointer to current IBBody
 ///	\param	recvPositionBuffer		buffer with the marker positions
@@ -1088,33 +809,85 @@ void MpiManager::mpi_ptCloudMarkerGather(IBBody *iBody, std::vector<double> &rec
 
 
 // *****************************************************************************
-///	\brief	Scatter information after sorting the point cloud marker IDs
+///	\brief	Renumber the point cloud markers of a body by a distributed sample sort
+///
+///			The markers on each rank are given consecutive IDs in the order of
+///			their current IDs across all ranks. Regular samples of the sorted 
+///			local IDs choose splitters so that each rank sorts one bucket of 
+///			IDs, the bucket offsets come from a prefix sum and the new IDs are
+///			returned to the ranks holding the markers.
 ///
 ///	\param	iBody					pointer to current IBBody
-///	\param	sendSortedIDBuffer		buffer with the marker positions
-///	\param	recvSizeBuffer			size of the buffers
-///	\param	recvDisps				vector with the relative displacements for the buffers
-void MpiManager::mpi_ptCloudMarkerScatter(IBBody *iBody, std::vector<int> &sendSortedIDBuffer, std::vector<int> &recvSizeBuffer, std::vector<int> &recvDisps) {
+void MpiManager::mpi_ptCloudMarkerSort(IBBody *iBody) {
 
-	// Get ranks which exist on this level
-	std::vector<int> glob2lev = mpi_mapRankWorldToLevel(iBody->level);
+	// Communicator and rank within this level
+	MPI_Comm comm = lev_comm[iBody->level];
+	int nLevRanks, levRank;
+	MPI_Comm_size(comm, &nLevRanks);
+	MPI_Comm_rank(comm, &levRank);
 
-	// Get root ID in this communicator
-	int rootRankLev = glob2lev[iBody->owningRank];
-
-	// Get number of markers to be sent
+	// Sort the local IDs keeping the index of the marker they belong to
 	int nMarkers = static_cast<int>(iBody->markers.size());
-
-	// Create receive buffers
-	std::vector<int> recvSortedIDBuffer(nMarkers, 0);
-
-	// Scatter to all ranks
-	MPI_Scatterv(&sendSortedIDBuffer.front(), &recvSizeBuffer.front(), &recvDisps.front(), MPI_INT, &recvSortedIDBuffer.front(), nMarkers, MPI_INT, rootRankLev, lev_comm[iBody->level]);
-
-	// Unpack into correct place
-	if (my_rank != iBody->owningRank) {
-		for (int i = 0; i < nMarkers; i++) {
-			iBody->markers[i].id = recvSortedIDBuffer[i];
-		}
-	}
+	std::vector<std::pair<int, int>> localIDs(nMarkers);
+	for (int m = 0; m < nMarkers; m++)
+		localIDs[m] = std::make_pair(iBody->markers[m].id, m);
+	std::sort(localIDs.begin(), localIDs.end());
+
+	// Take regular samples (ranks without markers give samples which are ignored)
+	const int noSample = std::numeric_limits<int>::max();
+	std::vector<int> samples(nLevRanks - 1, noSample);
+	if (nMarkers > 0) {
+		for (int i = 0; i < nLevRanks - 1; i++)
+			samples[i] = localIDs[(static_cast<size_t>(i) + 1) * nMarkers / nLevRanks].first;
+	}
+	std::vector<int> allSamples(samples.size() * nLevRanks);
+	MPI_Allgather(samples.data(), static_cast<int>(samples.size()), MPI_INT,
+		allSamples.data(), static_cast<int>(samples.size()), MPI_INT, comm);
+
+	// Choose the splitters from the valid samples
+	std::sort(allSamples.begin(), allSamples.end());
+	size_t nValid = std::lower_bound(allSamples.begin(), allSamples.end(), noSample) - allSamples.begin();
+	std::vector<int> splitters(nLevRanks - 1, noSample);
+	for (int i = 0; i < nLevRanks - 1; i++) {
+		if (nValid > 0)
+			splitters[i] = allSamples[(static_cast<size_t>(i) + 1) * nValid / nLevRanks];
+	}
+
+	// Count how many IDs go to each bucket (local IDs are sorted so buckets are contiguous)
+	std::vector<int> sendCounts(nLevRanks, 0), sendDisps(nLevRanks, 0);
+	std::vector<int> sendIDs(nMarkers);
+	for (int i = 0; i < nMarkers; i++) {
+		sendIDs[i] = localIDs[i].first;
+		sendCounts[std::upper_bound(splitters.begin(), splitters.end(), sendIDs[i]) - splitters.begin()]++;
+	}
+	for (int r = 1; r < nLevRanks; r++)
+		sendDisps[r] = sendDisps[r - 1] + sendCounts[r - 1];
+
+	// Send the IDs to the rank sorting their bucket
+	std::vector<int> recvCounts(nLevRanks, 0), recvDisps(nLevRanks, 0);
+	MPI_Alltoall(sendCounts.data(), 1, MPI_INT, recvCounts.data(), 1, MPI_INT, comm);
+	for (int r = 1; r < nLevRanks; r++)
+		recvDisps[r] = recvDisps[r - 1] + recvCounts[r - 1];
+	int nBucket = recvDisps.back() + recvCounts.back();
+	std::vector<int> bucketIDs(nBucket);
+	MPI_Alltoallv(sendIDs.data(), sendCounts.data(), sendDisps.data(), MPI_INT,
+		bucketIDs.data(), recvCounts.data(), recvDisps.data(), MPI_INT, comm);
+
+	// Sort the bucket and get its offset in the global order
+	std::vector<int> order(nBucket);
+	for (int i = 0; i < nBucket; i++) order[i] = i;
+	std::sort(order.begin(), order.end(), [&](int a, int b) { return bucketIDs[a] < bucketIDs[b]; });
+	int offset = 0;
+	MPI_Exscan(&nBucket, &offset, 1, MPI_INT, MPI_SUM, comm);
+	if (levRank == 0) offset = 0;
+
+	// Replace each ID with its new value
+	for (int i = 0; i < nBucket; i++)
+		bucketIDs[order[i]] = offset + i;
+
+	// Return the new IDs to the ranks holding the markers
+	MPI_Alltoallv(bucketIDs.data(), recvCounts.data(), recvDisps.data(), MPI_INT,
+		sendIDs.data(), sendCounts.data(), sendDisps.data(), MPI_INT, comm);
+	for (int i = 0; i < nMarkers; i++)
+		iBody->markers[localIDs[i].second].id = sendIDs[i];
 }
@@ -72,10 +72,22 @@ ObjectManager::ObjectManager(GridObj* g) : _Grids(g)
 	// Resize vector of flexible body flags
 	hasIBMBodies.resize(L_NUM_LEVELS+1 ,false);
 	hasFlexibleBodies.resize(L_NUM_LEVELS+1 ,false);
+	hasMovableBFLBodies.resize(L_NUM_LEVELS+1 ,false);
+
+	// Resize IBM site sets
+	ibmSites.resize(L_NUM_LEVELS + 1);
+	ibmDirtySites.resize(L_NUM_LEVELS + 1);
 
 	// Set sub-iteration loop values
 	timeav_subResidual = 0.0;
 	timeav_subIterations = 0.0;
+
+#ifdef L_IBM_DELTA_TABLE
+	// Tabulate the delta kernel out to the edge of its support
+	deltaTable.resize(static_cast<int>(1.5 * L_IBM_DELTA_TABLE) + 2);
+	for (size_t t = 0; t < deltaTable.size(); t++)
+		deltaTable[t] = ibm_deltaKernel(static_cast<double>(t) / L_IBM_DELTA_TABLE, 1.0);
+#endif
 };
 
 // ************************************************************************* //
@@ -167,24 +179,25 @@ void ObjectManager::computeLiftDrag(int i, int j, int k, GridObj *g) {
 /// \brief	Compute forces on a BFL rigid object.
 ///
 ///			Uses momentum exchange to compute forces on a marker than makes up
-///			a BFL body. Currently only works with a single BFL body but can 
-///			easily be upgraded.
+///			a BFL body.
 ///
 ///	\param	v			lattice direction of link being considered.
 ///	\param	id			collapsed ijk index for site on which BFL BC is being applied.
 /// \param	g			pointer to grid on which marker resides.
+/// \param	bodyID		index of BFL body on which force is to be updated.
 /// \param	markerID	id of marker on which force is to be updated.
-void ObjectManager::computeLiftDrag(int v, int id, GridObj *g, int markerID)
+void ObjectManager::computeLiftDrag(int v, int id, GridObj *g, int bodyID, int markerID)
 {
 	// Get opposite once
 	int v_opp = GridUtils::getOpposite(v);
 
 	// Similar to BBB but we cannot assume that bounced-back population is the same anymore
-	pBody[0].markers[markerID].forceX +=
+	BFLMarker &marker = pBody[bodyID].markers[markerID];
+	marker.forceX +=
 		c[eXDirection][v_opp] * (g->f[v_opp + id * L_NUM_VELS] + g->fNew[v + id * L_NUM_VELS]);
-	pBody[0].markers[markerID].forceY +=
+	marker.forceY +=
 		c[eYDirection][v_opp] * (g->f[v_opp + id * L_NUM_VELS] + g->fNew[v + id * L_NUM_VELS]);
-	pBody[0].markers[markerID].forceZ +=
+	marker.forceZ +=
 		c[eZDirection][v_opp] * (g->f[v_opp + id * L_NUM_VELS] + g->fNew[v + id * L_NUM_VELS]);
 }
 
@@ -342,6 +355,115 @@ void ObjectManager::addBouncebackObject(GridObj *g, GeomPacked *geom, PCpts *_PC
 	}
 }
 
+// ************************************************************************* //
+/// \brief	Adds a bounce-back body to the grid by voxelising a mesh.
+///
+///			Override of the usual method which labels the body on every grid
+///			it covers so it can span multiple levels. See the cloud version 
+///			for why the sites behind the finer grids are labelled too.
+///
+/// \param	geom	pointer to structure containing object information read from config file.
+/// \param	mesh	closed surface mesh in global coordinates.
+void ObjectManager::addBouncebackObject(GeomPacked *geom, TriMesh &mesh)
+{
+	// Store information about the body in the Object Manager
+	bbbOnGridLevel = geom->onGridLev;
+	bbbOnGridReg = geom->onGridReg;
+
+	// Label every grid on this rank
+	GridObj *g = nullptr;
+	for (int lev = L_NUM_LEVELS; lev >= 0; lev--)
+	{
+		for (int reg = 0; reg < L_NUM_REGIONS; reg++)
+		{
+			GridUtils::getGrid(lev, reg, g);
+			if (g) voxeliseMesh(g, mesh, true);
+		}
+	}
+}
+
+// ************************************************************************* //
+/// \brief	Adds a bounce-back body to the grid by voxelising a mesh.
+/// \param	g		pointer to grid on which object resides.
+/// \param	geom	pointer to structure containing object information read from config file.
+/// \param	mesh	closed surface mesh in global coordinates.
+void ObjectManager::addBouncebackObject(GridObj *g, GeomPacked *geom, TriMesh &mesh)
+{
+	// Store information about the body in the Object Manager
+	bbbOnGridLevel = geom->onGridLev;
+	bbbOnGridReg = geom->onGridReg;
+
+	voxeliseMesh(g, mesh, false);
+}
+
+// ************************************************************************* //
+/// \brief	Labels the sites of a grid inside a closed mesh as solid.
+///
+///			A ray is cast in the X-direction along each row of sites on this 
+///			rank and sites with an odd number of crossings before them are 
+///			inside. Rows are independent so are voxelised concurrently.
+///
+/// \param	g				pointer to grid.
+/// \param	mesh			closed surface mesh in global coordinates.
+/// \param	bAllowRefined	label any site other than velocity sites rather than only fluid sites.
+void ObjectManager::voxeliseMesh(GridObj *g, TriMesh &mesh, bool bAllowRefined)
+{
+	int N_lim = g->N_lim, M_lim = g->M_lim, K_lim = g->K_lim;
+
+	// Only the triangles in line with the rows of this grid are needed (halos may wrap)
+	double bbMin[3], bbMax[3];
+	bbMin[eXDirection] = -std::numeric_limits<double>::max();
+	bbMax[eXDirection] = std::numeric_limits<double>::max();
+	bbMin[eYDirection] = *std::min_element(g->YPos.begin(), g->YPos.end()) - g->dh;
+	bbMax[eYDirection] = *std::max_element(g->YPos.begin(), g->YPos.end()) + g->dh;
+#if (L_DIMS == 3)
+	bbMin[eZDirection] = *std::min_element(g->ZPos.begin(), g->ZPos.end()) - g->dh;
+	bbMax[eZDirection] = *std::max_element(g->ZPos.begin(), g->ZPos.end()) + g->dh;
+#else
+	bbMin[eZDirection] = 0.0;
+	bbMax[eZDirection] = 0.0;
+#endif
+	TriMesh local(mesh);
+	local.cull(bbMin, bbMax);
+	local.buildBins(g->dh);
+	if (local.empty()) return;
+
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+	for (int row = 0; row < M_lim * K_lim; row++)
+	{
+		int j = row / K_lim;
+		int k = row % K_lim;
+
+		// Crossings along this row
+		std::vector<double> xCross;
+#if (L_DIMS == 3)
+		local.getRayCrossings(g->YPos[j], g->ZPos[k], xCross);
+#else
+		local.getRayCrossings(g->YPos[j], 0.0, xCross);
+#endif
+		if (xCross.size() < 2) continue;
+
+		size_t n = 0;
+		for (int i = 0; i < N_lim; i++)
+		{
+			// Count the crossings before this site
+			while (n < xCross.size() && xCross[n] <= g->XPos[i]) n++;
+			if (n % 2 == 0) continue;
+
+			int id = k + j * K_lim + i * K_lim * M_lim;
+			if (bAllowRefined ? g->LatTyp[id] == eVelocity : g->LatTyp[id] != eFluid) continue;
+
+			// Change type and macro
+			g->LatTyp[id] = eSolid;
+			for (int d = 0; d < L_DIMS; d++)
+				g->u[d + id * L_DIMS] = 0.0;
+			g->rho[id] = L_RHOIN;
+		}
+	}
+}
+
 // ************************************************************************* //
 /// Private method for opening/closing a debugging file
 ///	\param	g	pointer to grid toggling the stream
@@ -0,0 +1,104 @@
+/*
+* --------------------------------------------------------------
+*
+* ------ Lattice Boltzmann @ The University of Manchester ------
+*
+* -------------------------- L-U-M-A ---------------------------
+*
+* Copyright 2018 The University of Manchester
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.*
+*/
+
+#include "../inc/stdafx.h"
+#include "../inc/ObjectManager.h"
+#include "../inc/GridObj.h"
+
+
+// *****************************************************************************
+///	\brief	Move the MOVABLE BFL bodies on a grid.
+///
+///			Each body is advanced with its prescribed velocity. Bodies which
+///			are relabelled have the sites they uncover refilled and the BFL
+///			links of the grid are rebuilt. Called at the start of every time
+///			step on the grid.
+///
+///	\param	g	pointer to grid.
+void ObjectManager::bfl_moveBodies(GridObj *g)
+{
+	bool bRelabelled = false;
+	std::vector<int> vacated;
+
+	for (BFLBody &body : pBody)
+	{
+		if (body._Owner != g || !body.isMovable) continue;
+
+		if (body.moveBody(vacated))
+		{
+			bfl_refillSites(g, vacated, body.uWall);
+			bRelabelled = true;
+		}
+	}
+
+	// Links store the Q values so must be rebuilt
+	if (bRelabelled) g->LBM_initBFLLinks();
+}
+
+// *****************************************************************************
+///	\brief	Reinitialise sites uncovered by a moving BFL body.
+///
+///			Fresh fluid sites are set to equilibrium at the wall velocity and
+///			the mean density of the neighbouring fluid sites which were not
+///			uncovered.
+///
+///	\param	g		pointer to grid.
+///	\param	sites	sorted flattened indices of the uncovered sites.
+///	\param	uWall	velocity of the body (dimensionless).
+void ObjectManager::bfl_refillSites(GridObj *g, const std::vector<int> &sites, const std::vector<double> &uWall)
+{
+	int M_lim = g->M_lim;
+	int K_lim = g->K_lim;
+
+	for (int id : sites)
+	{
+		int i = id / (K_lim * M_lim);
+		int j = (id / K_lim) % M_lim;
+		int k = id % K_lim;
+
+		// Average density of the established fluid neighbours
+		double rhoSum = 0.0;
+		int count = 0;
+		for (int v = 0; v < L_NUM_VELS; ++v)
+		{
+			int in = i + c_opt[v][0];
+			int jn = j + c_opt[v][1];
+			int kn = k + c_opt[v][2];
+			if (GridUtils::isOffGrid(in, jn, kn, g)) continue;
+
+			int nid = kn + jn * K_lim + in * K_lim * M_lim;
+			if (nid == id || g->LatTyp[nid] != eFluid ||
+				std::binary_search(sites.begin(), sites.end(), nid)) continue;
+
+			rhoSum += g->rho[nid];
+			count++;
+		}
+		if (count > 0) g->rho[id] = rhoSum / count;
+
+		// Set to equilibrium moving with the wall
+		for (int d = 0; d < L_DIMS; ++d)
+			g->u[d + id * L_DIMS] = uWall[d] * g->dt / g->dh;
+
+		for (int v = 0; v < L_NUM_VELS; ++v)
+			g->f[v + id * L_NUM_VELS] = g->_LBM_equilibrium_opt(id, v);
+	}
+}
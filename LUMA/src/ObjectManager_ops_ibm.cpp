@@ -42,7 +42,7 @@ void ObjectManager::ibm_apply(GridObj *g, bool doSubIterate) {
 	ibm_spread(g->level);
 
 	// Update the macroscopic values
-	ibm_updateMacroscopic(g->level);
+	ibm_updateMacroscopic(g);
 
 	// Perform FEM
 	if (hasFlexibleBodies[g->level])
@@ -70,10 +70,14 @@ void ObjectManager::ibm_moveBodies(int level) {
 	mpim->mpi_forceCommGather(level);
 #endif
 
-	// Loop through flexible bodies and apply FEM
-	for (auto ib : idxFEM) {
+	// Loop through flexible bodies and apply FEM (bodies are independent so can be solved concurrently)
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+	for (int i = 0; i < static_cast<int>(idxFEM.size()); i++) {
 
 		// Only do if on this grid level
+		int ib = idxFEM[i];
 		if (iBody[ib]._Owner->level == level)
 			iBody[ib].fBody->dynamicFEM();
 	}
@@ -86,8 +90,8 @@ void ObjectManager::ibm_moveBodies(int level) {
 	// Loop through flexible bodies and update the support points for all valid markers existing on this rank
 	for (size_t ib = 0; ib < iBody.size(); ib++) {
 
-		// Only do if on this grid level
-		if (iBody[ib]._Owner->level == level && iBody[ib].isFlexible)
+		// Only do if on this grid level and the markers have actually moved
+		if (iBody[ib]._Owner->level == level && iBody[ib].isFlexible && !iBody[ib].isSupportCurrent())
 			ibm_findSupport(static_cast<int>(ib));
 	}
 
@@ -96,6 +100,9 @@ void ObjectManager::ibm_moveBodies(int level) {
 	ibm_updateMPIComms(level);
 #endif
 
+	// Update the sites affected by IBM
+	ibm_buildSiteSet(level);
+
 	// Compute ds
 	ibm_computeDs(level);
 
@@ -119,11 +126,27 @@ void ObjectManager::ibm_subIterate(GridObj *g) {
 	// Do the while loop for sub iteration
 	do {
 
+		/* Only the sites IBM touched since the last reset differ from the start 
+		 * of the time step so restore velocity and reset force there only. */
+		std::vector<int> &dirty = ibmDirtySites[g->level];
+		std::sort(dirty.begin(), dirty.end());
+		dirty.erase(std::unique(dirty.begin(), dirty.end()), dirty.end());
+
 		// Reset velocities to start of time step
-		g->u = g->u_n;
+		for (auto id : dirty) {
+			for (int d = 0; d < L_DIMS; d++)
+				g->u[d + id * L_DIMS] = g->u_n[d + id * L_DIMS];
+		}
 
-		// Reset forces
+		// Reset forces (gravity depends on the updated density everywhere)
+#ifdef L_GRAVITY_ON
 		g->_LBM_resetForces();
+#else
+		g->_LBM_resetForces(dirty);
+#endif
+
+		// Only the current support can be modified by the next pass
+		dirty = ibmSites[g->level];
 
 		// Apply IBM again
 		ibm_apply(g, false);
@@ -156,6 +179,9 @@ void ObjectManager::ibm_subIterate(GridObj *g) {
 			iBody[ib].fBody->Udot_n = iBody[ib].fBody->Udot;
 			iBody[ib].fBody->Udotdot_n = iBody[ib].fBody->Udotdot;
 
+			// Restart the coupling for the next time step
+			iBody[ib].fBody->resetCoupling();
+
 			// Get time averaged FEM values
 			iBody[ib].fBody->timeav_FEMIterations *= (g->t % L_GRID_OUT_FREQ);
 			iBody[ib].fBody->timeav_FEMIterations += iBody[ib].fBody->it;
@@ -178,7 +204,8 @@ void ObjectManager::ibm_subIterate(GridObj *g) {
 		for (auto ib : idxFEM) {
 			if (iBody[ib]._Owner->level == g->level) {
 				*GridUtils::logfile << "Body " << iBody[ib].id << ": FEM solver taking " << iBody[ib].fBody->timeav_FEMIterations <<
-						" iterations to reach a residual of " << iBody[ib].fBody->timeav_FEMResidual << std::endl;
+						" iterations to reach a residual of " << iBody[ib].fBody->timeav_FEMResidual <<
+						" (last relaxation factor " << iBody[ib].fBody->relax << ")" << std::endl;
 			}
 		}
 	}
@@ -225,6 +252,12 @@ void ObjectManager::ibm_initialise() {
 		ibm_updateMPIComms(lev);
 #endif
 
+	// Find the sites affected by IBM
+	for (int lev = 0; lev < std::min(levToLoop + 1, L_NUM_LEVELS + 1); lev++) {
+		ibmDirtySites[lev].clear();
+		ibm_buildSiteSet(lev);
+	}
+
 	// Compute ds
 	for (int lev = 0; lev < (levToLoop+1); lev++)
 		ibm_computeDs(lev);
@@ -258,26 +291,58 @@ double ObjectManager::ibm_deltaKernel(double radius, double dilation) {
 	if (mag_r > 1.5) {
 		value = 0.0;
 	} else if (mag_r > 0.5) {
-		value = (5.0 - (3.0 * mag_r) - sqrt(-3.0 * pow( 1.0 - mag_r, 2) + 1.0)) / 6.0;
+		value = (5.0 - (3.0 * mag_r) - sqrt(-3.0 * ((1.0 - mag_r) * (1.0 - mag_r)) + 1.0)) / 6.0;
 	} else {
-		value = (1.0 + sqrt(1.0 - 3.0 * pow(mag_r, 2) ) ) / 3.0;
+		value = (1.0 + sqrt(1.0 - 3.0 * (mag_r * mag_r))) / 3.0;
 	}
 
 	return value;
 }
 
 
+// *****************************************************************************
+///	\brief	Evaluate delta kernel for an array of distances
+///
+///			Both branches of the kernel are computed and the result selected
+///			so the loop has no data-dependent control flow and can be 
+///			vectorised. With L_IBM_DELTA_TABLE the kernel is instead 
+///			interpolated linearly from a table built at start up.
+///
+///	\param	radius			distances
+///	\param	dilation		dilation parameter
+///	\param	n				number of distances
+///	\param	value			delta values
+void ObjectManager::ibm_deltaKernel(const double *radius, double dilation, int n, double *value) {
+
+#ifdef L_IBM_DELTA_TABLE
+
+	const double *table = deltaTable.data();
+	int nTable = static_cast<int>(deltaTable.size());
+	for (int i = 0; i < n; i++) {
+		double pos = fabs(radius[i]) / dilation * L_IBM_DELTA_TABLE;
+		int t = std::min(static_cast<int>(pos), nTable - 2);
+		double w = std::min(pos - t, 1.0);
+		value[i] = (1.0 - w) * table[t] + w * table[t + 1];
+	}
+
+#else
+
+	for (int i = 0; i < n; i++) {
+		double mag_r = fabs(radius[i]) / dilation;
+		double inner = (1.0 + sqrt(std::max(1.0 - 3.0 * (mag_r * mag_r), 0.0))) / 3.0;
+		double outer = (5.0 - (3.0 * mag_r) - sqrt(std::max(-3.0 * ((1.0 - mag_r) * (1.0 - mag_r)) + 1.0, 0.0))) / 6.0;
+		value[i] = (mag_r > 1.5) ? 0.0 : ((mag_r > 0.5) ? outer : inner);
+	}
+#endif
+}
+
+
 // *****************************************************************************
 ///	\brief	Finds support points for iBody
 ///
 ///	\param	ib			body index
 void ObjectManager::ibm_findSupport(int ib) {
 
-#ifdef L_BUILD_FOR_MPI
-	MpiManager *mpim = MpiManager::getInstance();
-	int estimated_rank_offset[3] = { 0, 0, 0 };
-#endif
-
 	// Get the rank
 	int rank = GridUtils::safeGetRank();
 
@@ -287,6 +352,11 @@ void ObjectManager::ibm_findSupport(int ib) {
 	std::vector<double> nearpos(3, 0);
 	std::vector<double> estimated_position(3, 0);
 
+	// Candidate support positions, distances and deltas along each axis
+	const int nCage = 11;
+	double estPos[3][nCage], dist[3][nCage], delta[3][nCage];
+	double dh = iBody[ib]._Owner->dh;
+
 	// Loop through all valid markers (which exist on this rank)
 	for (auto m : iBody[ib].validMarkers) {
 
@@ -304,6 +374,7 @@ void ObjectManager::ibm_findSupport(int ib) {
 		x = iBody[ib].markers[m].position[eXDirection];
 		y = iBody[ib].markers[m].position[eYDirection];
 		z = iBody[ib].markers[m].position[eZDirection];
+		double dilation = iBody[ib].markers[m].dilation;
 
 		// Get ijk of enclosing voxel and insert into support
 		std::vector<int> ijk;
@@ -314,11 +385,6 @@ void ObjectManager::ibm_findSupport(int ib) {
 		jnear = ijk[eYDirection];
 		knear = ijk[eZDirection];
 
-		// Insert into support
-		iBody[ib].markers[m].supp_i.push_back(inear);
-		iBody[ib].markers[m].supp_j.push_back(jnear);
-		iBody[ib].markers[m].supp_k.push_back(knear);
-
 		// Set position
 		nearpos[eXDirection] = iBody[ib]._Owner->XPos[ijk[eXDirection]];
 		nearpos[eYDirection] = iBody[ib]._Owner->YPos[ijk[eYDirection]];
@@ -326,49 +392,64 @@ void ObjectManager::ibm_findSupport(int ib) {
 		nearpos[eZDirection] = iBody[ib]._Owner->ZPos[ijk[eZDirection]];
 #endif
 
+		/* Estimate positions of the candidate support points along each axis
+		 * rather than read from the grid in case the point is outside the rank.
+		 * Estimate only works since LBM lattice uniformly spaced. The kernel is
+		 * separable so it is evaluated once per axis for the whole cage. */
+		for (int d = 0; d < L_DIMS; d++) {
+			for (int n = 0; n < nCage; n++) {
+				estPos[d][n] = nearpos[d] + (n - nCage / 2) * dh;
+				dist[d][n] = (estPos[d][n] - iBody[ib].markers[m].position[d]) / dh;
+			}
+			ibm_deltaKernel(dist[d], dilation, nCage, delta[d]);
+		}
+
+		// Insert nearest into support
+		iBody[ib].markers[m].supp_i.push_back(inear);
+		iBody[ib].markers[m].supp_j.push_back(jnear);
+		iBody[ib].markers[m].supp_k.push_back(knear);
+
 		// Set the x-y-z of the support marker
 		iBody[ib].markers[m].supp_x.push_back(nearpos[eXDirection]);
 		iBody[ib].markers[m].supp_y.push_back(nearpos[eYDirection]);
 		iBody[ib].markers[m].supp_z.push_back(nearpos[eZDirection]);
 
-
 		// Get the deltaval for the first support point
-		ibm_initialiseSupport(ib, m, nearpos);
+		iBody[ib].markers[m].deltaval.push_back(delta[eXDirection][nCage / 2] * delta[eYDirection][nCage / 2]
+#if (L_DIMS == 3)
+			* delta[eZDirection][nCage / 2]
+#endif
+			);
 
 		// Set rank of first support marker
 		iBody[ib].markers[m].support_rank.push_back(rank);
 
 		// Loop over surrounding 5 lattice sites and check if within support region
 		for (int i = inear - 5; i <= inear + 5; i++) {
+			int ni = i - inear + nCage / 2;
+			if (!(fabs(dist[eXDirection][ni]) < 1.5 * dilation)) continue;
+
 			for (int j = jnear - 5; j <= jnear + 5; j++) {
+				int nj = j - jnear + nCage / 2;
+				if (!(fabs(dist[eYDirection][nj]) < 1.5 * dilation)) continue;
+
 #if (L_DIMS == 3)
 				for (int k = knear - 5; k <= knear + 5; k++)
 #else
 				int k = 0;
 #endif
 				{
-					/* Estimate position of support point rather than read from the
-					 * grid in case the point is outside the rank.
-					 * Estimate only works since LBM lattice uniformly spaced. */
-					estimated_position[eXDirection] = nearpos[eXDirection] + (i - inear) * iBody[ib]._Owner->dh;
-					estimated_position[eYDirection] = nearpos[eYDirection] + (j - jnear) * iBody[ib]._Owner->dh;
 #if (L_DIMS == 3)
-					estimated_position[eZDirection] = nearpos[eZDirection] + (k - knear) * iBody[ib]._Owner->dh;
+					int nk = k - knear + nCage / 2;
+					if (!(fabs(dist[eZDirection][nk]) < 1.5 * dilation)) continue;
 #endif
-					/* Find distance between Lagrange marker and proposed support point and
-					 * Check if inside the cage (convert to lattice units) */
-					if	(
-						(fabs(iBody[ib].markers[m].position[eXDirection] - estimated_position[eXDirection]) / iBody[ib]._Owner->dh
-						< 1.5 * iBody[ib].markers[m].dilation)
-						&&
-						(fabs(iBody[ib].markers[m].position[eYDirection] - estimated_position[eYDirection]) / iBody[ib]._Owner->dh
-						< 1.5 * iBody[ib].markers[m].dilation)
+					estimated_position[eXDirection] = estPos[eXDirection][ni];
+					estimated_position[eYDirection] = estPos[eYDirection][nj];
 #if (L_DIMS == 3)
-						&&
-						(fabs(iBody[ib].markers[m].position[eZDirection] - estimated_position[eZDirection]) / iBody[ib]._Owner->dh
-						< 1.5 * iBody[ib].markers[m].dilation)
+					estimated_position[eZDirection] = estPos[eZDirection][nk];
 #endif
-						&& GridUtils::isWithinDomain(estimated_position))
+					// Inside the cage so check it is also inside the domain
+					if (GridUtils::isWithinDomain(estimated_position))
 					{
 
 						// Skip the nearest as already added when marker constructed
@@ -388,47 +469,22 @@ void ObjectManager::ibm_findSupport(int ib) {
 							iBody[ib].markers[m].supp_y.push_back(estimated_position[eYDirection]);
 							iBody[ib].markers[m].supp_z.push_back(estimated_position[eZDirection]);
 
-							// Initialise delta information for the set of support points including
+							// Delta information for the set of support points including
 							// those not on this rank using estimated positions
-							ibm_initialiseSupport(ib, m, estimated_position);
+							iBody[ib].markers[m].deltaval.push_back(delta[eXDirection][ni] * delta[eYDirection][nj]
+#if (L_DIMS == 3)
+								* delta[eZDirection][nk]
+#endif
+								);
 
 							// Add owning rank as this one for now
 							iBody[ib].markers[m].support_rank.push_back(rank);
 
 #ifdef L_BUILD_FOR_MPI
-							/* Estimate which rank this point belongs to by seeing which
-							 * edge of the grid it is off. Use estimated rather than
-							 * actual positions. Compare to sender layer edges as if
-							 * it is on the recv layer it is belongs to the neighbour. */
-							if (estimated_position[eXDirection] < mpim->sender_layer_pos.X[eLeftMin])
-								estimated_rank_offset[eXDirection] = -1;
-							if (estimated_position[eXDirection] > mpim->sender_layer_pos.X[eRightMax])
-								estimated_rank_offset[eXDirection] = 1;
-							if (estimated_position[eYDirection] < mpim->sender_layer_pos.Y[eLeftMin])
-								estimated_rank_offset[eYDirection] = -1;
-							if (estimated_position[eYDirection] > mpim->sender_layer_pos.Y[eRightMax])
-								estimated_rank_offset[eYDirection] = 1;
-#if (L_DIMS == 3)
-							if (estimated_position[eZDirection] < mpim->sender_layer_pos.Z[eLeftMin])
-								estimated_rank_offset[eZDirection] = -1;
-							if (estimated_position[eZDirection] > mpim->sender_layer_pos.Z[eRightMax])
-								estimated_rank_offset[eZDirection] = 1;
-#endif
-
-							// Get MPI direction of the neighbour that owns this point
-							int owner_direction = GridUtils::getMpiDirection(estimated_rank_offset);
-							if (owner_direction != -1) {
-
-								// Owned by a neighbour so correct the support rank
-								iBody[ib].markers[m].support_rank.back() = mpim->neighbour_rank[owner_direction];
-							}
-
-							// Reset estimated rank offset
-							estimated_rank_offset[eXDirection] = 0;
-							estimated_rank_offset[eYDirection] = 0;
-#if (L_DIMS == 3)
-							estimated_rank_offset[eZDirection] = 0;
-#endif
+							/* Estimate which rank this point belongs to from the block 
+							 * edges. Use estimated rather than actual positions. If it 
+							 * is on the recv layer it belongs to the neighbour. */
+							iBody[ib].markers[m].support_rank.back() = GridUtils::getRankfromPosition(estimated_position);
 #endif
 						}
 					}
@@ -436,44 +492,12 @@ void ObjectManager::ibm_findSupport(int ib) {
 			}
 		}
 	}
-}
-
-
-// *****************************************************************************
-///	\brief	Initialise data associated with support points found
-///
-///	\param	ib							body index
-///	\param	m							marker index
-///	\param	estimated_position			position of support point
-void ObjectManager::ibm_initialiseSupport(int ib, int m, std::vector<double> &estimated_position)
-{
-
-	// Declarations
-	double dist_x, dist_y, delta_x, delta_y;	// Distances and deltas
-#if (L_DIMS == 3)
-	double dist_z, delta_z;
-#endif
-
-	// Distance between Lagrange marker and support node in lattice units
-	dist_x = (estimated_position[eXDirection] - iBody[ib].markers[m].position[eXDirection]) / iBody[ib]._Owner->dh;
-	dist_y = (estimated_position[eYDirection] - iBody[ib].markers[m].position[eYDirection]) / iBody[ib]._Owner->dh;
-#if (L_DIMS == 3)
-	dist_z = (estimated_position[eZDirection] - iBody[ib].markers[m].position[eZDirection]) / iBody[ib]._Owner->dh;
-#endif
 
-	// Store delta function value
-	delta_x = ibm_deltaKernel(dist_x, iBody[ib].markers[m].dilation);
-	delta_y = ibm_deltaKernel(dist_y, iBody[ib].markers[m].dilation);
-#if (L_DIMS == 3)
-	delta_z = ibm_deltaKernel(dist_z, iBody[ib].markers[m].dilation);
-#endif
+	// Pack the support for interpolation and spreading
+	iBody[ib].flattenSupport();
 
-	// Calculate the delta value for the marker
-	iBody[ib].markers[m].deltaval.push_back(delta_x * delta_y
-#if (L_DIMS == 3)
-		* delta_z
-#endif	
-		);
+	// Remember where the markers were so an unmoved body can skip this next time
+	iBody[ib].storeSupportCache();
 }
 
 
@@ -483,85 +507,44 @@ void ObjectManager::ibm_initialiseSupport(int ib, int m, std::vector<double> &es
 ///	\param	level		current grid level
 void ObjectManager::ibm_interpolate(int level) {
 
-	// Get rank
-	int rank = GridUtils::safeGetRank();
-
 	// Loop through all bodies
 	for (size_t ib = 0; ib < iBody.size(); ib++) {
 
 		// Only interpolate the bodies that exist on this grid level
 		if (iBody[ib]._Owner->level == level) {
 
-			// Get grid sizes
-			size_t M_lim = iBody[ib]._Owner->M_lim;
-#if (L_DIMS == 3)
-			size_t K_lim = iBody[ib]._Owner->K_lim;
-#endif
+			// Grid data
+			const std::vector<double> &rho = iBody[ib]._Owner->rho;
+			const std::vector<double> &u = iBody[ib]._Owner->u;
 
-			// For each marker
-			for (auto m : iBody[ib].validMarkers) {
+			// For each marker (each thread only writes to its own markers)
+			int numValid = static_cast<int>(iBody[ib].validMarkers.size());
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+			for (int v = 0; v < numValid; v++) {
+				IBMarker &marker = iBody[ib].markers[iBody[ib].validMarkers[v]];
 
 				// Reset the values of interpolated velocity and density
-				std::fill(iBody[ib].markers[m].interpMom.begin(), iBody[ib].markers[m].interpMom.end(), 0.0);
-				iBody[ib].markers[m].interpRho = 0.0;
-
-				// Loop over support nodes
-				for (size_t i = 0; i < iBody[ib].markers[m].deltaval.size(); i++) {
+				std::fill(marker.interpMom.begin(), marker.interpMom.end(), 0.0);
+				marker.interpRho = 0.0;
 
-					// Only interpolate over data this rank actually owns at the moment
-					if (rank == iBody[ib].markers[m].support_rank[i]) {
+				// Loop over the support sites this rank owns
+				for (int s = iBody[ib].suppStart[v]; s < iBody[ib].suppStart[v + 1]; s++) {
+					int id = iBody[ib].suppSite[s];
 
+					// Interpolate density
+					marker.interpRho += rho[id] * iBody[ib].suppWeight[s] * marker.local_area;
 
-						// Interpolate density
-#if (L_DIMS == 2)
-						iBody[ib].markers[m].interpRho += iBody[ib]._Owner->rho(
-								iBody[ib].markers[m].supp_i[i],
-								iBody[ib].markers[m].supp_j[i], M_lim) *
-								iBody[ib].markers[m].deltaval[i] * iBody[ib].markers[m].local_area;
-#else
-						iBody[ib].markers[m].interpRho += iBody[ib]._Owner->rho(
-								iBody[ib].markers[m].supp_i[i],
-								iBody[ib].markers[m].supp_j[i],
-								iBody[ib].markers[m].supp_k[i],
-								M_lim, K_lim) *
-								iBody[ib].markers[m].deltaval[i] * iBody[ib].markers[m].local_area;
-#endif
-
-						// Loop over directions x y z
-						for (int dir = 0; dir < L_DIMS; dir++) {
-
-							// Read given velocity component from support node, multiply by delta function
-							// for that support node and sum to get interpolated velocity.
-#if (L_DIMS == 2)
-
-							iBody[ib].markers[m].interpMom[dir] += iBody[ib]._Owner->rho(
-									iBody[ib].markers[m].supp_i[i],
-									iBody[ib].markers[m].supp_j[i], M_lim) *
-									iBody[ib]._Owner->u(
-									iBody[ib].markers[m].supp_i[i],
-									iBody[ib].markers[m].supp_j[i],
-									dir, M_lim, L_DIMS) * iBody[ib].markers[m].deltaval[i] * iBody[ib].markers[m].local_area;
-#else
-							iBody[ib].markers[m].interpMom[dir] += iBody[ib]._Owner->rho(
-									iBody[ib].markers[m].supp_i[i],
-									iBody[ib].markers[m].supp_j[i],
-									iBody[ib].markers[m].supp_k[i],
-									M_lim, K_lim) *
-									iBody[ib]._Owner->u(
-									iBody[ib].markers[m].supp_i[i],
-									iBody[ib].markers[m].supp_j[i],
-									iBody[ib].markers[m].supp_k[i],
-									dir, M_lim, K_lim, L_DIMS) * iBody[ib].markers[m].deltaval[i] * iBody[ib].markers[m].local_area;
-#endif
-						}
-					}
+					// Read given velocity component from support node, multiply by delta function
+					// for that support node and sum to get interpolated velocity.
+					for (int dir = 0; dir < L_DIMS; dir++)
+						marker.interpMom[dir] += rho[id] * u[id * L_DIMS + dir] * iBody[ib].suppWeight[s] * marker.local_area;
 				}
 			}
 		}
 	}
 
-
-
 	// Pass the necessary values between ranks
 #ifdef L_BUILD_FOR_MPI
 	ibm_interpolateOffRankVels(level);
@@ -608,53 +591,41 @@ void ObjectManager::ibm_computeForce(int level) {
 ///	\param	level		current grid level
 void ObjectManager::ibm_spread(int level) {
 
-	// Get rank
-	int rank = GridUtils::safeGetRank();
-
 	// Loop through bodies
 	for (size_t ib = 0; ib < iBody.size(); ib++) {
 
 		// Only spread the bodies that exist on this grid level
 		if (iBody[ib]._Owner->level == level) {
 
-			// Get volume scaling
-			double volWidth, volDepth;
-
-			// Get grid sizes
-			size_t M_lim = iBody[ib]._Owner->M_lim;
-			size_t K_lim = iBody[ib]._Owner->K_lim;
+			// Grid force
+			std::vector<double> &force = iBody[ib]._Owner->force_xyz;
 
-			// Loop through markers
-			for (auto m : iBody[ib].validMarkers) {
-
-				// Loop through support sites
-				for (size_t s = 0; s < iBody[ib].markers[m].deltaval.size(); s++) {
+			/* Overlapping supports mean several markers add to the same site so 
+			 * loop over the distinct sites instead. Each thread then owns the 
+			 * sites it updates and adds the contributions in marker order, 
+			 * giving the same result whatever the number of threads. */
+			int numSites = static_cast<int>(iBody[ib].uniqueSite.size());
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+			for (int u = 0; u < numSites; u++) {
+				int id = iBody[ib].uniqueSite[u];
 
-					// Only spread over data this rank actually owns at the moment
-					if (rank == iBody[ib].markers[m].support_rank[s]) {
+				// Loop over the markers supported by this site
+				for (int e = iBody[ib].uniqueStart[u]; e < iBody[ib].uniqueStart[u + 1]; e++) {
+					int s = iBody[ib].uniqueEntry[e];
+					IBMarker &marker = iBody[ib].markers[iBody[ib].validMarkers[iBody[ib].suppMarker[s]]];
 
-						// Set volume scaling
-						volWidth = iBody[ib].markers[m].epsilon;
-						volDepth = 1.0;
+					// Set volume scaling
+					double volWidth = marker.epsilon;
+					double volDepth = 1.0;
 #if (L_DIMS == 3)
-						volDepth = iBody[ib].markers[m].ds;
+					volDepth = marker.ds;
 #endif
 
-						// Loop over directions x y z
-						for (size_t dir = 0; dir < L_DIMS; dir++) {
-
-							// Add contribution of current marker force to support node Cartesian force vector using delta values computed when support was computed
-							iBody[ib]._Owner->force_xyz(
-									iBody[ib].markers[m].supp_i[s],
-									iBody[ib].markers[m].supp_j[s],
-									iBody[ib].markers[m].supp_k[s],
-									dir, M_lim, K_lim, L_DIMS) -=
-									iBody[ib].markers[m].deltaval[s] *
-									iBody[ib].markers[m].force_xyz[dir] *
-									volWidth * volDepth *
-									iBody[ib].markers[m].ds;
-						}
-					}
+					// Add contribution of current marker force to support node Cartesian force vector using delta values computed when support was computed
+					for (int dir = 0; dir < L_DIMS; dir++)
+						force[id * L_DIMS + dir] -= iBody[ib].suppWeight[s] * marker.force_xyz[dir] * volWidth * volDepth * marker.ds;
 				}
 			}
 		}
@@ -680,77 +651,76 @@ void ObjectManager::ibm_spread(int level) {
 // *****************************************************************************
 ///	\brief	Update the macroscopic values at the support points
 ///
-///	\param	level		current grid level
-void ObjectManager::ibm_updateMacroscopic(int level) {
-
-	// Get rank
-	int rank = GridUtils::safeGetRank();
+///			Covers the support sites of markers on this rank and of markers 
+///			off-rank, each site once.
+///
+///	\param	g		pointer to current grid
+void ObjectManager::ibm_updateMacroscopic(GridObj *g) {
 
 	// Grid indices and type
 	int idx, jdx, kdx, id;
 	eType type_local;
 
-	// First do all support points that belong to markers that this rank owns
-	// Loop through all IBM bodies
-	for (size_t ib = 0; ib < iBody.size(); ib++) {
+	// Loop through the distinct sites IBM affects on this level
+	const std::vector<int> &sites = ibmSites[g->level];
+	int numSites = static_cast<int>(sites.size());
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for private(idx, jdx, kdx, id, type_local)
+#endif
+	for (int s = 0; s < numSites; s++) {
 
-		// Only do if body belongs to this grid level
-		if (iBody[ib]._Owner->level == level) {
+		// Get indices from the flattened index
+		id = sites[s];
+		idx = id / (g->K_lim * g->M_lim);
+		jdx = (id / g->K_lim) % g->M_lim;
+		kdx = id % g->K_lim;
+		type_local = g->LatTyp[id];
 
-			// Loop through all markers
-			for (auto m : iBody[ib].validMarkers) {
-				for (size_t s = 0; s < iBody[ib].markers[m].deltaval.size(); s++) {
+		// Update macroscopic value at this site
+		g->_LBM_macro_opt(idx, jdx, kdx, id, type_local);
+	}
+}
 
-					// Only do if this rank actually owns this support site
-					if (iBody[ib].markers[m].support_rank[s] == rank) {
 
-						// Get indices
-						idx = iBody[ib].markers[m].supp_i[s];
-						jdx = iBody[ib].markers[m].supp_j[s];
-						kdx = iBody[ib].markers[m].supp_k[s];
+// *****************************************************************************
+///	\brief	Collect the distinct lattice sites IBM modifies on this rank
+///
+///			These are the on-rank support sites of all bodies on this level 
+///			together with the sites this rank holds for off-rank markers. Must 
+///			be rebuilt whenever the support or the MPI support comms change.
+///
+///	\param	level		current grid level
+void ObjectManager::ibm_buildSiteSet(int level) {
 
-						// Grid site index and type
-						id = kdx + jdx * iBody[ib]._Owner->K_lim + idx * iBody[ib]._Owner->K_lim * iBody[ib]._Owner->M_lim;
-						type_local = iBody[ib]._Owner->LatTyp[id];
+	std::vector<int> &sites = ibmSites[level];
+	sites.clear();
 
-						// Update macroscopic value at this site
-						iBody[ib]._Owner->_LBM_macro_opt(idx, jdx, kdx, id, type_local);
-					}
-				}
-			}
-		}
+	// Support sites of markers on this rank
+	for (size_t ib = 0; ib < iBody.size(); ib++) {
+		if (iBody[ib]._Owner->level == level)
+			sites.insert(sites.end(), iBody[ib].uniqueSite.begin(), iBody[ib].uniqueSite.end());
 	}
 
-	// Now loop through any support sites this rank owns which belong to markers off-rank
+	// Support sites this rank owns which belong to markers off-rank
 #ifdef L_BUILD_FOR_MPI
-	int ib;
-
-	// Get MPI manager instance
 	MpiManager *mpim = MpiManager::getInstance();
-
-	// Loop through any support sites this rank owns which belong to markers off-rank
 	for (size_t i = 0; i < mpim->supportCommSupportSide[level].size(); i++) {
-
-		// Get body idx
-		ib = bodyIDToIdx[mpim->supportCommSupportSide[level][i].bodyID];
-
-		// Only do if body is on this grid level
+		int ib = bodyIDToIdx[mpim->supportCommSupportSide[level][i].bodyID];
 		if (iBody[ib]._Owner->level == level) {
-
-			// Get indices
-			idx = mpim->supportCommSupportSide[level][i].supportIdx[eXDirection];
-			jdx = mpim->supportCommSupportSide[level][i].supportIdx[eYDirection];
-			kdx = mpim->supportCommSupportSide[level][i].supportIdx[eZDirection];
-
-			// Grid site index and type
-			id = kdx + jdx * iBody[ib]._Owner->K_lim + idx * iBody[ib]._Owner->K_lim * iBody[ib]._Owner->M_lim;
-			type_local = iBody[ib]._Owner->LatTyp[id];
-
-			// Update macroscopic value at this site
-			iBody[ib]._Owner->_LBM_macro_opt(idx, jdx, kdx, id, type_local);
+			GridObj *g = iBody[ib]._Owner;
+			sites.push_back(mpim->supportCommSupportSide[level][i].supportIdx[eZDirection] +
+				mpim->supportCommSupportSide[level][i].supportIdx[eYDirection] * g->K_lim +
+				mpim->supportCommSupportSide[level][i].supportIdx[eXDirection] * g->K_lim * g->M_lim);
 		}
 	}
 #endif
+
+	// Remove duplicates
+	std::sort(sites.begin(), sites.end());
+	sites.erase(std::unique(sites.begin(), sites.end()), sites.end());
+
+	// These sites may be modified from now on
+	ibmDirtySites[level].insert(ibmDirtySites[level].end(), sites.begin(), sites.end());
 }
 
 
@@ -762,14 +732,8 @@ void ObjectManager::ibm_findEpsilon(int level) {
 
 #ifdef L_UNIVERSAL_EPSILON_CALC
 
-	// Temorary iBody for storing all markers in whole simulation
-	std::vector<IBBody> iBodyTmp(1);
-
-	// Gather all the markers into the temporary iBody vector
-	ibm_universalEpsilonGather(level, iBodyTmp[0]);
-
-	// Set the pointer values to avoid copying memory
-	std::vector<IBBody> *iBodyPtr = &iBodyTmp;
+	// Solve for all markers on this level together
+	ibm_findEpsilonUniversal(level);
 
 #else
 
@@ -782,9 +746,8 @@ void ObjectManager::ibm_findEpsilon(int level) {
 		mpim->mpi_epsilonCommGather(level);
 	#endif
 
-		// Set the pointer values to avoid copying memory
-		std::vector<IBBody> *iBodyPtr = &iBody;
-#endif
+	// Set the pointer values to avoid copying memory
+	std::vector<IBBody> *iBodyPtr = &iBody;
 
 	// Get rank
 	int rank = GridUtils::safeGetRank();
@@ -797,8 +760,26 @@ void ObjectManager::ibm_findEpsilon(int level) {
 			to be computed to ensure conservation while using the interpolation functions. Epsilon is this weighting.
 			We can use built-in libraries to solve the ensuing linear system in future. */
 
+#ifdef L_IBM_EPSILON_CACHE
+
+			// Reuse epsilon if the body has been in this position relative to the lattice before
+			std::vector<double> markerGeometry = (*iBodyPtr)[ib].getMarkerGeometry();
+			std::vector<double> supportGeometry = (*iBodyPtr)[ib].getSupportGeometry();
+			int cacheEntry = (*iBodyPtr)[ib].findEpsilonCacheEntry(markerGeometry, &supportGeometry);
+			if (cacheEntry >= 0) {
+				for (size_t m = 0; m < (*iBodyPtr)[ib].markers.size(); m++)
+					(*iBodyPtr)[ib].markers[m].epsilon = (*iBodyPtr)[ib].epsilonCache[cacheEntry].epsilon[m];
+				continue;
+			}
+#endif
+
+#ifdef L_IBM_SPARSE_EPSILON
+			ibm_findEpsilonSparse((*iBodyPtr)[ib]);
+#else
+
 			// Declarations
 			double Delta_I, Delta_J;
+			std::vector<double> dist[L_DIMS], delta[L_DIMS];
 
 			//////////////////////////////////
 			//	Build coefficient matrix A	//
@@ -812,40 +793,39 @@ void ObjectManager::ibm_findEpsilon(int level) {
 			// Loop over support of marker I and integrate delta value multiplied by delta value of marker J.
 			for (size_t I = 0; I < (*iBodyPtr)[ib].markers.size(); I++) {
 
+				IBMarker &mI = (*iBodyPtr)[ib].markers[I];
+				int nSupp = static_cast<int>(mI.deltaval.size());
+				for (int d = 0; d < L_DIMS; d++) {
+					dist[d].resize(nSupp);
+					delta[d].resize(nSupp);
+				}
+
 				// Loop over markers J
 				for (size_t J = 0; J < (*iBodyPtr)[ib].markers.size(); J++) {
 
+					// Evaluate delta of J at each support of I along each axis
+					for (int s = 0; s < nSupp; s++) {
+						dist[eXDirection][s] = ((*iBodyPtr)[ib].markers[J].position[eXDirection] - mI.supp_x[s]) / (*iBodyPtr)[ib].dh;
+						dist[eYDirection][s] = ((*iBodyPtr)[ib].markers[J].position[eYDirection] - mI.supp_y[s]) / (*iBodyPtr)[ib].dh;
+#if (L_DIMS == 3)
+						dist[eZDirection][s] = ((*iBodyPtr)[ib].markers[J].position[eZDirection] - mI.supp_z[s]) / (*iBodyPtr)[ib].dh;
+#endif
+					}
+					for (int d = 0; d < L_DIMS; d++)
+						ibm_deltaKernel(dist[d].data(), (*iBodyPtr)[ib].markers[J].dilation, nSupp, delta[d].data());
+
 					// Sum delta values evaluated for each support of I
-					for (size_t s = 0; s < (*iBodyPtr)[ib].markers[I].deltaval.size(); s++) {
+					for (int s = 0; s < nSupp; s++) {
 
-						Delta_I = (*iBodyPtr)[ib].markers[I].deltaval[s];
+						Delta_I = mI.deltaval[s];
+						Delta_J = delta[eXDirection][s] * delta[eYDirection][s]
 #if (L_DIMS == 3)
-						Delta_J =
-							ibm_deltaKernel(
-							((*iBodyPtr)[ib].markers[J].position[eXDirection] - (*iBodyPtr)[ib].markers[I].supp_x[s]) / (*iBodyPtr)[ib].dh,
-							(*iBodyPtr)[ib].markers[J].dilation
-							) *
-							ibm_deltaKernel(
-							((*iBodyPtr)[ib].markers[J].position[eYDirection] - (*iBodyPtr)[ib].markers[I].supp_y[s]) / (*iBodyPtr)[ib].dh,
-							(*iBodyPtr)[ib].markers[J].dilation
-							) *
-							ibm_deltaKernel(
-							((*iBodyPtr)[ib].markers[J].position[eZDirection] - (*iBodyPtr)[ib].markers[I].supp_z[s]) / (*iBodyPtr)[ib].dh,
-							(*iBodyPtr)[ib].markers[J].dilation
-							);
-#else
-						Delta_J =
-							ibm_deltaKernel(
-							((*iBodyPtr)[ib].markers[J].position[eXDirection] - (*iBodyPtr)[ib].markers[I].supp_x[s]) / (*iBodyPtr)[ib].dh,
-							(*iBodyPtr)[ib].markers[J].dilation
-							) *
-							ibm_deltaKernel(
-							((*iBodyPtr)[ib].markers[J].position[eYDirection] - (*iBodyPtr)[ib].markers[I].supp_y[s]) / (*iBodyPtr)[ib].dh,
-							(*iBodyPtr)[ib].markers[J].dilation
-							);
+							* delta[eZDirection][s]
 #endif
+							;
+
 						// Multiply by local area (or volume in 3D)
-						A[I][J] += Delta_I * Delta_J * (*iBodyPtr)[ib].markers[I].local_area;
+						A[I][J] += Delta_I * Delta_J * mI.local_area;
 					}
 
 					// Multiply by arc length between markers in lattice units
@@ -867,15 +847,25 @@ void ObjectManager::ibm_findEpsilon(int level) {
 			for (size_t m = 0; m < (*iBodyPtr)[ib].markers.size(); m++) {
 				(*iBodyPtr)[ib].markers[m].epsilon = epsilon[m];
 			}
-		}
-	}
+#endif
 
-#ifdef L_UNIVERSAL_EPSILON_CALC
+#ifdef L_IBM_EPSILON_CACHE
 
-	// Redistribute epsilon
-	ibm_universalEpsilonScatter(level, iBodyTmp[0]);
+			// Add to the cache, dropping the oldest entry if full
+			IBBody::EpsilonCacheEntry entry;
+			entry.markerGeometry.swap(markerGeometry);
+			entry.supportGeometry.swap(supportGeometry);
+			for (size_t m = 0; m < (*iBodyPtr)[ib].markers.size(); m++) {
+				entry.ds.push_back((*iBodyPtr)[ib].markers[m].ds);
+				entry.epsilon.push_back((*iBodyPtr)[ib].markers[m].epsilon);
+			}
+			if ((*iBodyPtr)[ib].epsilonCache.size() >= L_IBM_EPSILON_CACHE)
+				(*iBodyPtr)[ib].epsilonCache.erase((*iBodyPtr)[ib].epsilonCache.begin());
+			(*iBodyPtr)[ib].epsilonCache.push_back(entry);
+#endif
+		}
+	}
 
-#else
 	#ifdef L_BUILD_FOR_MPI
 
 		// Perform MPI communication and insert correct epsilon values
@@ -885,6 +875,265 @@ void ObjectManager::ibm_findEpsilon(int level) {
 }
 
 
+// *****************************************************************************
+///	\brief	Find epsilon for a body using a sparse system
+///
+///			Only markers whose supports overlap have a non-zero coefficient so
+///			the system is assembled in compressed sparse row format and solved
+///			iteratively starting from the previous epsilon.
+///
+///	\param	body	body whose epsilon is to be computed
+void ObjectManager::ibm_findEpsilonSparse(IBBody &body) {
+
+	int numMarkers = static_cast<int>(body.markers.size());
+
+	// Every marker is both a row and a column
+	std::vector<IBMarker*> rows(numMarkers);
+	std::vector<double> colData(numMarkers * (L_DIMS + 2));
+	for (int m = 0; m < numMarkers; m++) {
+		rows[m] = &body.markers[m];
+		for (int d = 0; d < L_DIMS; d++)
+			colData[m * (L_DIMS + 2) + d] = body.markers[m].position[d];
+		colData[m * (L_DIMS + 2) + L_DIMS] = body.markers[m].dilation;
+		colData[m * (L_DIMS + 2) + L_DIMS + 1] = body.markers[m].ds;
+	}
+
+	// Assemble the rows
+	std::vector<int> rowPtr, colIdx;
+	std::vector<double> val;
+	ibm_assembleEpsilonSystem(rows, colData, body.dh, rowPtr, colIdx, val);
+
+	// Start from the previous solution if there is one
+	std::vector<double> bVector(numMarkers, 1.0), epsilon(numMarkers, 0.0);
+	for (int m = 0; m < numMarkers; m++) {
+		epsilon[m] = body.markers[m].epsilon;
+		if (epsilon[m] == 0.0) {
+			for (int e = rowPtr[m]; e < rowPtr[m + 1]; e++) {
+				if (colIdx[e] == m) epsilon[m] = 1.0 / val[e];
+			}
+		}
+	}
+
+	// Solve system
+	int iter = GridUtils::solveSparseLinearSystem(rowPtr, colIdx, val, bVector, epsilon,
+		L_IBM_EPSILON_TOL, L_IBM_EPSILON_MAX_ITER);
+	if (iter < 0)
+		L_WARN("Epsilon solve for body " + std::to_string(body.id) + " did not converge.", GridUtils::logfile);
+
+	// Assign epsilon
+	for (int m = 0; m < numMarkers; m++) {
+		body.markers[m].epsilon = epsilon[m];
+	}
+}
+
+
+// *****************************************************************************
+///	\brief	Find epsilon for all markers on a level as a single distributed system
+///
+///			Used when supports of different bodies overlap. Each rank assembles
+///			the rows of the markers it holds, with markers on neighbouring 
+///			ranks which can interact with them exchanged as ghost columns, and
+///			the system is solved in parallel. Epsilon is then returned to the
+///			owners of the bodies.
+///
+///	\param	level		current grid level
+void ObjectManager::ibm_findEpsilonUniversal(int level) {
+
+	// Markers on this rank give the rows of the system
+	std::vector<IBMarker*> rows;
+	std::vector<double> colData;
+	double maxDilation = 0.0;
+	for (size_t ib = 0; ib < iBody.size(); ib++) {
+		if (iBody[ib].level == level) {
+			for (auto m : iBody[ib].validMarkers) {
+				rows.push_back(&iBody[ib].markers[m]);
+				for (int d = 0; d < L_DIMS; d++)
+					colData.push_back(iBody[ib].markers[m].position[d]);
+				colData.push_back(iBody[ib].markers[m].dilation);
+				colData.push_back(iBody[ib].markers[m].ds);
+				maxDilation = std::max(maxDilation, iBody[ib].markers[m].dilation);
+			}
+		}
+	}
+	int nLocal = static_cast<int>(rows.size());
+	double dh = _Grids->dh / pow(2.0, level);
+
+#ifdef L_BUILD_FOR_MPI
+
+	// Get mpi manager instance
+	MpiManager *mpim = MpiManager::getInstance();
+
+	// Add markers from other ranks which interact with the ones here as extra columns
+	MPI_Allreduce(MPI_IN_PLACE, &maxDilation, 1, MPI_DOUBLE, MPI_MAX, mpim->lev_comm[level]);
+	std::vector<double> ghostData;
+	mpim->mpi_uniEpsilonBuildGhosts(level, colData, 3.0 * maxDilation * dh, ghostData);
+	colData.insert(colData.end(), ghostData.begin(), ghostData.end());
+#endif
+
+	// Assemble the rows
+	std::vector<int> rowPtr, colIdx;
+	std::vector<double> val;
+	ibm_assembleEpsilonSystem(rows, colData, dh, rowPtr, colIdx, val);
+
+	// Start from the previous solution if there is one
+	std::vector<double> bVector(nLocal, 1.0), epsilon(colData.size() / (L_DIMS + 2), 0.0);
+	for (int m = 0; m < nLocal; m++) {
+		epsilon[m] = rows[m]->epsilon;
+		if (epsilon[m] == 0.0) {
+			for (int e = rowPtr[m]; e < rowPtr[m + 1]; e++) {
+				if (colIdx[e] == m) epsilon[m] = 1.0 / val[e];
+			}
+		}
+	}
+
+	// Solve system
+#ifdef L_BUILD_FOR_MPI
+	int iter = GridUtils::solveSparseLinearSystem(rowPtr, colIdx, val, bVector, epsilon,
+		L_IBM_EPSILON_TOL, L_IBM_EPSILON_MAX_ITER,
+		[mpim, nLocal](std::vector<double> &x) { mpim->mpi_uniEpsilonUpdateGhosts(x, nLocal); },
+		[mpim, level](double *sum, int n) { MPI_Allreduce(MPI_IN_PLACE, sum, n, MPI_DOUBLE, MPI_SUM, mpim->lev_comm[level]); });
+#else
+	int iter = GridUtils::solveSparseLinearSystem(rowPtr, colIdx, val, bVector, epsilon,
+		L_IBM_EPSILON_TOL, L_IBM_EPSILON_MAX_ITER);
+#endif
+	if (iter < 0)
+		L_WARN("Universal epsilon solve on level " + std::to_string(level) + " did not converge.", GridUtils::logfile);
+
+	// Assign epsilon
+	for (int m = 0; m < nLocal; m++) {
+		rows[m]->epsilon = epsilon[m];
+	}
+
+#ifdef L_BUILD_FOR_MPI
+
+	// Body owners need epsilon for the markers held elsewhere
+	mpim->mpi_epsilonCommReturn(level);
+#endif
+}
+
+
+// *****************************************************************************
+///	\brief	Assemble rows of the epsilon system
+///
+///			Only markers whose supports overlap have a non-zero coefficient so
+///			the interacting pairs are found by binning the column markers on a
+///			hash grid.
+///
+///	\param	rows		markers giving the rows (also the first columns)
+///	\param	colData		position, dilation and ds of each column marker
+///	\param	dh			lattice spacing
+///	\param	rowPtr		index of first entry of each row
+///	\param	colIdx		column index of each entry
+///	\param	val			value of each entry
+void ObjectManager::ibm_assembleEpsilonSystem(const std::vector<IBMarker*> &rows, const std::vector<double> &colData, double dh,
+	std::vector<int> &rowPtr, std::vector<int> &colIdx, std::vector<double> &val) {
+
+	const int stride = L_DIMS + 2;
+	int numRows = static_cast<int>(rows.size());
+	int numCols = static_cast<int>(colData.size()) / stride;
+
+	// Hash grid cells are as wide as the largest interaction distance
+	double maxDilation = 0.0;
+	for (int J = 0; J < numCols; J++) maxDilation = std::max(maxDilation, colData[J * stride + L_DIMS]);
+	double cellWidth = 3.0 * maxDilation * dh;
+	auto cellOf = [cellWidth](double pos) { return static_cast<long long>(std::floor(pos / cellWidth)); };
+	auto cellKey = [](long long i, long long j, long long k) {
+		return ((i + (1 << 20)) << 42) + ((j + (1 << 20)) << 21) + (k + (1 << 20));
+	};
+
+	// Bin the markers
+	std::unordered_map<long long, std::vector<int>> bins;
+	for (int J = 0; J < numCols; J++) {
+		const double *pos = &colData[J * stride];
+		bins[cellKey(cellOf(pos[eXDirection]), cellOf(pos[eYDirection]),
+			(L_DIMS == 3) ? cellOf(pos[eZDirection]) : 0)].push_back(J);
+	}
+
+	// Assemble the rows
+	rowPtr.assign(numRows + 1, 0);
+	colIdx.clear();
+	val.clear();
+	std::vector<int> candidates;
+	std::vector<double> lines[L_DIMS], dist[L_DIMS], delta[L_DIMS];
+	std::vector<int> lineIdx[L_DIMS];
+	for (int I = 0; I < numRows; I++) {
+
+		IBMarker &mI = *rows[I];
+		long long ci = cellOf(mI.position[eXDirection]);
+		long long cj = cellOf(mI.position[eYDirection]);
+		long long ck = (L_DIMS == 3) ? cellOf(mI.position[eZDirection]) : 0;
+
+		// Markers close enough for the supports to overlap
+		candidates.clear();
+		for (int di = -1; di <= 1; di++) {
+			for (int dj = -1; dj <= 1; dj++) {
+				for (int dk = (L_DIMS == 3 ? -1 : 0); dk <= (L_DIMS == 3 ? 1 : 0); dk++) {
+					auto bin = bins.find(cellKey(ci + di, cj + dj, ck + dk));
+					if (bin == bins.end()) continue;
+					for (int J : bin->second) {
+						double reach = 1.5 * (mI.dilation + colData[J * stride + L_DIMS]) * dh;
+						bool bClose = true;
+						for (int d = 0; d < L_DIMS; d++) {
+							if (fabs(mI.position[d] - colData[J * stride + d]) >= reach) bClose = false;
+						}
+						if (bClose) candidates.push_back(J);
+					}
+				}
+			}
+		}
+		std::sort(candidates.begin(), candidates.end());
+
+		/* The support of I lies on a few lattice lines along each axis so the
+		 * separable kernel of J only needs evaluating once per line */
+		int nSupp = static_cast<int>(mI.deltaval.size());
+		const std::vector<double> *suppPos[3] = { &mI.supp_x, &mI.supp_y, &mI.supp_z };
+		for (int d = 0; d < L_DIMS; d++) {
+			lines[d].clear();
+			lineIdx[d].resize(nSupp);
+			for (int s = 0; s < nSupp; s++) {
+				double p = (*suppPos[d])[s];
+				size_t l = std::find(lines[d].begin(), lines[d].end(), p) - lines[d].begin();
+				if (l == lines[d].size()) lines[d].push_back(p);
+				lineIdx[d][s] = static_cast<int>(l);
+			}
+			dist[d].resize(lines[d].size());
+			delta[d].resize(lines[d].size());
+		}
+
+		// Integrate over the support of I as for the dense system
+		for (int J : candidates) {
+
+			const double *posJ = &colData[J * stride];
+			double dilationJ = colData[J * stride + L_DIMS];
+			for (int d = 0; d < L_DIMS; d++) {
+				for (size_t l = 0; l < lines[d].size(); l++)
+					dist[d][l] = (posJ[d] - lines[d][l]) / dh;
+				ibm_deltaKernel(dist[d].data(), dilationJ, static_cast<int>(lines[d].size()), delta[d].data());
+			}
+
+			double a = 0.0;
+			for (int s = 0; s < nSupp; s++) {
+				double Delta_J =
+					delta[eXDirection][lineIdx[eXDirection][s]] *
+					delta[eYDirection][lineIdx[eYDirection][s]]
+#if (L_DIMS == 3)
+					* delta[eZDirection][lineIdx[eZDirection][s]]
+#endif
+					;
+				a += mI.deltaval[s] * Delta_J * mI.local_area;
+			}
+			a *= colData[J * stride + L_DIMS + 1];
+
+			if (a != 0.0) {
+				colIdx.push_back(J);
+				val.push_back(a);
+			}
+		}
+		rowPtr[I + 1] = static_cast<int>(colIdx.size());
+	}
+}
+
+
 // *****************************************************************************
 ///	\brief	Compute ds for each marker
 ///
@@ -906,6 +1155,17 @@ void ObjectManager::ibm_computeDs(int level) {
 			// Get grid spacing
 			dh = iBody[ib]._Owner->dh;
 
+#ifdef L_IBM_EPSILON_CACHE
+
+			// Spacing only depends on the marker geometry so reuse it if seen before
+			int cacheEntry = iBody[ib].findEpsilonCacheEntry(iBody[ib].getMarkerGeometry(), NULL);
+			if (cacheEntry >= 0) {
+				for (size_t m = 0; m < iBody[ib].markers.size(); m++)
+					iBody[ib].markers[m].ds = iBody[ib].epsilonCache[cacheEntry].ds[m];
+				continue;
+			}
+#endif
+
 			// Now loop through all markers
 			for (size_t m = 0; m < iBody[ib].markers.size(); m++) {
 
@@ -1022,86 +1282,3 @@ void ObjectManager::ibm_finaliseReadIn(int iBodyID) {
 		}
 	}
 }
-
-
-// *****************************************************************************
-///	\brief	Gather all the markers into the temporary iBody vector
-///
-///	\param	level		current grid level
-///	\param	iBodyTmp	container for all markers in entire simulation
-void ObjectManager::ibm_universalEpsilonGather(int level, IBBody &iBodyTmp) {
-
-
-#ifdef L_BUILD_FOR_MPI
-
-	// Get mpi manager instance
-	MpiManager *mpim = MpiManager::getInstance();
-
-	// Set root rank
-	std::vector<int> lev2glob = mpim->mpi_mapRankLevelToWorld(level);
-	int rootRank = lev2glob[0];
-
-	// Gather in the data for all markers in the system
-	mpim->mpi_uniEpsilonCommGather(level, rootRank, iBodyTmp);
-
-#else
-
-	// Loop through all iBodies and all markers
-	for (int ib = 0; ib < iBody.size(); ib++) {
-
-		// Check if this body is on this grid level
-		if (iBody[ib].level == level) {
-
-			// Set markers
-			for (int m = 0; m < iBody[ib].markers.size(); m++) {
-				iBodyTmp.markers.push_back(iBody[ib].markers[m]);
-			}
-
-			// Set the global values
-			iBodyTmp.owningRank = 0;
-			iBodyTmp.level = level;
-			iBodyTmp._Owner = iBody[ib]._Owner;
-			iBodyTmp.dh = iBody[ib].dh;
-		}
-	}
-
-
-#endif
-}
-
-
-// *****************************************************************************
-///	\brief	Spread all the epsilon values to all ranks which own markers
-///
-///	\param	level		current grid level.
-///	\param	iBodyTmp	container for all markers in entire simulation
-void ObjectManager::ibm_universalEpsilonScatter(int level, IBBody &iBodyTmp) {
-
-
-#ifdef L_BUILD_FOR_MPI
-
-	// Get mpi manager instance
-	MpiManager *mpim = MpiManager::getInstance();
-
-	// Set root rank
-	std::vector<int> lev2glob = mpim->mpi_mapRankLevelToWorld(level);
-	int rootRank = lev2glob[0];
-
-	// Gather in the data for all markers in the system
-	mpim->mpi_uniEpsilonCommScatter(level, rootRank, iBodyTmp);
-
-#else
-
-	// Loop through all iBodies and all markers
-	int markerIdx = 0;
-	for (int ib = 0; ib < iBody.size(); ib++) {
-		if (iBody[ib].level == level) {
-			for (int m = 0; m < iBody[ib].markers.size(); m++) {
-				iBody[ib].markers[m].epsilon = iBodyTmp.markers[markerIdx].epsilon;
-				markerIdx++;
-			}
-		}
-	}
-
-#endif
-}
@@ -52,14 +52,12 @@ void ObjectManager::ibm_interpolateOffRankVels(int level) {
 	MpiManager *mpim = MpiManager::getInstance();
 
 	// Perform interpolation communication
-	std::vector<std::vector<double>> interpVels;
-	mpim->mpi_interpolateComm(level, interpVels);
-
-	// Create idx vector
-	std::vector<int> idx(mpim->num_ranks, 0);
+	mpim->mpi_interpolateComm(level);
+	const std::vector<double> &interpVels = mpim->supportNbrMarkerSide[level].buffer;
+	const std::vector<int> &entryDispl = mpim->supportNbrMarkerSide[level].entryDispl;
 
 	// Now interpolate these remaining values onto the marker
-	int ib, m, s, fromRank;
+	int ib, m, s, pos;
 	for (int i = 0; i < mpim->supportCommMarkerSide[level].size(); i++) {
 
 		// Get body idx
@@ -68,23 +66,17 @@ void ObjectManager::ibm_interpolateOffRankVels(int level) {
 		// Only do if body is on this grid level
 		if (iBody[ib]._Owner->level == level) {
 
-			// Get IDs of support site
+			// Get IDs of support site and its position in the buffer
 			m = mpim->supportCommMarkerSide[level][i].markerIdx;
 			s = mpim->supportCommMarkerSide[level][i].supportID;
-			fromRank = mpim->supportCommMarkerSide[level][i].rankComm;
+			pos = entryDispl[i] * (L_DIMS + 1);
 
 			// Interpolate density
-			iBody[ib].markers[m].interpRho += interpVels[fromRank][idx[fromRank]] * iBody[ib].markers[m].deltaval[s] * iBody[ib].markers[m].local_area;
-
-			// Shift index
-			idx[fromRank]++;
+			iBody[ib].markers[m].interpRho += interpVels[pos] * iBody[ib].markers[m].deltaval[s] * iBody[ib].markers[m].local_area;
 
 			// Interpolate these values
 			for (int dir = 0; dir < L_DIMS; dir++)
-				iBody[ib].markers[m].interpMom[dir] += interpVels[fromRank][dir+idx[fromRank]] * iBody[ib].markers[m].deltaval[s] * iBody[ib].markers[m].local_area;
-
-			// Shift index
-			idx[fromRank] += L_DIMS;
+				iBody[ib].markers[m].interpMom[dir] += interpVels[pos + 1 + dir] * iBody[ib].markers[m].deltaval[s] * iBody[ib].markers[m].local_area;
 		}
 	}
 }
@@ -99,16 +91,13 @@ void ObjectManager::ibm_spreadOffRankForces(int level) {
 	// Get the mpi manager instance
 	MpiManager *mpim = MpiManager::getInstance();
 
-	// Perform interpolation communication
-	std::vector<std::vector<double>> spreadForces;
-	mpim->mpi_spreadComm(level, spreadForces);
-
-	// Create idx vector
-	std::vector<int> idx(mpim->num_ranks, 0);
-	std::vector<int> suppIdx(3, 0);
+	// Perform spreading communication
+	mpim->mpi_spreadComm(level);
+	const std::vector<double> &spreadForces = mpim->supportNbrSupportSide[level].buffer;
+	const std::vector<int> &entryDispl = mpim->supportNbrSupportSide[level].entryDispl;
 
-	// Now interpolate these remaining values onto the marker
-	int ib, fromRank;
+	// Now spread these remaining values onto the support sites
+	int ib, pos;
 	for (int i = 0; i < mpim->supportCommSupportSide[level].size(); i++) {
 
 		// Get body idx
@@ -121,17 +110,14 @@ void ObjectManager::ibm_spreadOffRankForces(int level) {
 			size_t M_lim = iBody[ib]._Owner->M_lim;
 			size_t K_lim = iBody[ib]._Owner->K_lim;
 
-			// Get IDs of support site
-			fromRank = mpim->supportCommSupportSide[level][i].rankComm;
-			suppIdx = mpim->supportCommSupportSide[level][i].supportIdx;
+			// Get IDs of support site and its position in the buffer
+			const std::vector<int> &suppIdx = mpim->supportCommSupportSide[level][i].supportIdx;
+			pos = entryDispl[i] * L_DIMS;
 
 			// Interpolate these values
 			for (int dir = 0; dir < L_DIMS; dir++)
 				iBody[ib]._Owner->force_xyz(suppIdx[eXDirection], suppIdx[eYDirection], suppIdx[eZDirection], dir, M_lim, K_lim, L_DIMS) -=
-						spreadForces[fromRank][idx[fromRank] + dir];
-
-			// Shift index
-			idx[fromRank] += L_DIMS;
+						spreadForces[pos + dir];
 		}
 	}
 }
@@ -140,14 +126,31 @@ void ObjectManager::ibm_spreadOffRankForces(int level) {
 // *****************************************************************************
 ///	\brief	Update new markers across all ranks
 ///
+///			By default only flexible bodies are considered as these are the 
+///			only ones whose markers move. After the domain has been 
+///			redecomposed the markers of every body need redistributing.
+///
 ///	\param	level		current grid level
-void ObjectManager::ibm_updateMarkers(int level) {
+///	\param	bAllBodies	flag to redistribute the markers of all bodies rather than only flexible ones
+void ObjectManager::ibm_updateMarkers(int level, bool bAllBodies) {
 
 	// Get the mpi manager instance
 	MpiManager *mpim = MpiManager::getInstance();
 
-	// Loop through all flexible bodies that this rank owns
-	for (auto ib : idxFEM) {
+	// Bodies this rank owns whose markers need redistributing
+	std::vector<int> idxOwned;
+	if (bAllBodies) {
+		for (int ib = 0; ib < static_cast<int>(iBody.size()); ib++) {
+			if (iBody[ib].owningRank == mpim->my_rank)
+				idxOwned.push_back(ib);
+		}
+	}
+	else {
+		idxOwned = idxFEM;
+	}
+
+	// Loop through all bodies that this rank owns
+	for (auto ib : idxOwned) {
 
 		// Only do if on this grid level
 		if (iBody[ib]._Owner->level == level) {
@@ -165,13 +168,13 @@ void ObjectManager::ibm_updateMarkers(int level) {
 	std::vector<std::vector<std::vector<double>>> vels(iBody.size(), std::vector<std::vector<double>>(0, std::vector<double>(0)));
 
 	// Do MPI comm for spreading markers
-	mpim->mpi_spreadNewMarkers(level, markerIDs, positions, vels);
+	mpim->mpi_spreadNewMarkers(level, idxOwned, markerIDs, positions, vels);
 
 	// Loop through all iBodies
 	for (size_t ib = 0; ib < iBody.size(); ib++) {
 
 		// If body is on this level and flexible
-		if (iBody[ib]._Owner->level == level && iBody[ib].isFlexible) {
+		if (iBody[ib]._Owner->level == level && (iBody[ib].isFlexible || bAllBodies)) {
 
 			// Also if not owned by this rank
 			if (iBody[ib].owningRank != mpim->my_rank) {
@@ -404,7 +404,7 @@ void ObjectManager::io_readInGeomConfig() {
 			else if (direction == "Z")
 				scaleDirection = eZDirection;
 
-			// Check if flexible (note: BFL is always rigid no matter what the input is)
+			// Check if flexible (note: BFL bodies are never flexible no matter what the input is)
 			eMoveableType moveProperty;
 			if (flex_rigid == "FLEXIBLE") {
 				moveProperty = eFlexible;
@@ -412,6 +412,7 @@ void ObjectManager::io_readInGeomConfig() {
 			}
 			else if (flex_rigid == "MOVABLE") {
 				moveProperty = eMovable;
+				if (bodyType == eBFLCloud) hasMovableBFLBodies[lev] = true;
 			}
 			else if (flex_rigid == "RIGID")
 				moveProperty = eRigid;
@@ -434,13 +435,23 @@ void ObjectManager::io_readInGeomConfig() {
 				length, scaleDirection, moveProperty, clamped
 				);
 
+			// Read in data from triangle mesh file
+			if (TriMesh::isMeshFile(fileName))
+			{
+				L_INFO("Reading in triangle mesh...", GridUtils::logfile);
+				this->io_readInMesh(geom);
+			}
+
 			// Read in data from point cloud file
-			PCpts* _PCpts = NULL;
-			_PCpts = new PCpts();
-			
-			L_INFO("Reading in point cloud...", GridUtils::logfile); 
-			this->io_readInCloud(_PCpts, geom);
-			delete _PCpts;
+			else
+			{
+				PCpts* _PCpts = NULL;
+				_PCpts = new PCpts();
+
+				L_INFO("Reading in point cloud...", GridUtils::logfile);
+				this->io_readInCloud(_PCpts, geom);
+				delete _PCpts;
+			}
 			delete geom;
 			*GridUtils::logfile << "Finished creating Body " << iBodyID + pBodyID << "..." << std::endl;
 
@@ -497,7 +508,7 @@ void ObjectManager::io_readInGeomConfig() {
 			angles.push_back(angleVert);
 			angles.push_back(angleHorz);
 
-			// Check if flexible (note: BFL is always rigid no matter what the input is)
+			// Check if flexible (note: BFL bodies are never flexible no matter what the input is)
 			eMoveableType moveProperty;
 			if (flex_rigid == "FLEXIBLE") {
 				moveProperty = eFlexible;
@@ -552,7 +563,8 @@ void ObjectManager::io_readInGeomConfig() {
 						iBody.emplace_back(g, iBodyID + pBodyID, position, length, height, depth, angles, moveProperty, nElements, clamped, density, YoungMod);
 					}
 					else if (boundaryType == "BFL") {
-						pBody.emplace_back(g, iBodyID + pBodyID, position, length, angles);
+						if (moveProperty == eMovable) hasMovableBFLBodies[lev] = true;
+						pBody.emplace_back(g, iBodyID + pBodyID, position, length, angles, moveProperty);
 					}
 				}
 
@@ -597,7 +609,7 @@ void ObjectManager::io_readInGeomConfig() {
 			centre_point.push_back(centreY + shiftY);
 			centre_point.push_back(centreZ + shiftZ);
 
-			// Check if flexible (note: BFL is always rigid no matter what the input is)
+			// Check if flexible (note: BFL bodies are never flexible no matter what the input is)
 			eMoveableType moveProperty;
 			if (flex_rigid == "FLEXIBLE")
 				L_ERROR("Circle/sphere cannot be flexible. Exiting.", GridUtils::logfile);
@@ -620,7 +632,8 @@ void ObjectManager::io_readInGeomConfig() {
 					iBody.emplace_back(g, iBodyID + pBodyID, centre_point, radius, moveProperty);
 				}
 				else if (boundaryType == "BFL") {
-					pBody.emplace_back(g, iBodyID + pBodyID, centre_point, radius);
+					if (moveProperty == eMovable) hasMovableBFLBodies[lev] = true;
+					pBody.emplace_back(g, iBodyID + pBodyID, centre_point, radius, moveProperty);
 				}
 			}
 			*GridUtils::logfile << "Finished creating Body " << iBodyID + pBodyID << "..." << std::endl;
@@ -672,7 +685,7 @@ void ObjectManager::io_readInGeomConfig() {
 			angles.push_back(angleVert);
 			angles.push_back(angleHorz);
 
-			// Check if flexible (note: BFL is always rigid no matter what the input is)
+			// Check if flexible (note: BFL bodies are never flexible no matter what the input is)
 			eMoveableType moveProperty;
 			if (flex_rigid == "FLEXIBLE")
 				L_ERROR("Circle/sphere cannot be flexible. Exiting.", GridUtils::logfile);
@@ -695,7 +708,8 @@ void ObjectManager::io_readInGeomConfig() {
 					iBody.emplace_back(g, iBodyID + pBodyID, centre_point, dimensions, angles, moveProperty);
 				}
 				else if (boundaryType == "BFL") {
-					pBody.emplace_back(g, iBodyID + pBodyID, centre_point, dimensions, angles);
+					if (moveProperty == eMovable) hasMovableBFLBodies[lev] = true;
+					pBody.emplace_back(g, iBodyID + pBodyID, centre_point, dimensions, angles, moveProperty);
 				}
 			}
 			*GridUtils::logfile << "Finished creating Body " << iBodyID + pBodyID << "..." << std::endl;
@@ -751,7 +765,7 @@ void ObjectManager::io_readInGeomConfig() {
 			angles.push_back(angleY);
 			angles.push_back(angleZ);
 
-			// Check if flexible (note: BFL is always rigid no matter what the input is)
+			// Check if flexible (note: BFL bodies are never flexible no matter what the input is)
 			eMoveableType moveProperty;
 			if (flex_rigid == "FLEXIBLE")
 				L_ERROR("Plate cannot be flexible. Exiting.", GridUtils::logfile);
@@ -774,7 +788,8 @@ void ObjectManager::io_readInGeomConfig() {
 					iBody.emplace_back(g, iBodyID + pBodyID, centre_point, length, width, angles, moveProperty);
 				}
 				else if (boundaryType == "BFL") {
-					pBody.emplace_back(g, iBodyID + pBodyID, centre_point, length, width, angles);
+					if (moveProperty == eMovable) hasMovableBFLBodies[lev] = true;
+					pBody.emplace_back(g, iBodyID + pBodyID, centre_point, length, width, angles, moveProperty);
 				}
 			}
 			*GridUtils::logfile << "Finished creating Body " << iBodyID + pBodyID << "..." << std::endl;
@@ -793,6 +808,15 @@ void ObjectManager::io_readInGeomConfig() {
 
 	// Do some more IBM setup required after reading all bodies
 	ibm_finaliseReadIn(iBodyID);
+
+	// Build the BFL links on each grid owning BFL bodies
+	std::vector<GridObj*> bflGrids;
+	for (BFLBody& body : pBody)
+	{
+		if (std::find(bflGrids.begin(), bflGrids.end(), body._Owner) != bflGrids.end()) continue;
+		bflGrids.push_back(body._Owner);
+		body._Owner->LBM_initBFLLinks();
+	}
 }
 
 
@@ -844,129 +868,414 @@ void ObjectManager::io_readInCloud(PCpts*& _PCpts, GeomPacked *geom)
 		dCell = g->dh;
 	}
 
-	// Round reference values to complete number of voxels as measured from origin
-	double bodyRefX = std::round(geom->bodyRefX / dCell) * dCell;
-	double bodyRefY = std::round(geom->bodyRefY / dCell) * dCell;
-	double bodyRefZ = std::round(geom->bodyRefZ / dCell) * dCell;
-	double bodyLength = std::round(geom->bodyLength / dCell) * dCell;
-
-	// Write the scaled reference data
-#ifdef L_CLOUD_DEBUG
-	std::string msg("Scaled reference values are:");
-	msg += " X = " + std::to_string(bodyRefX);
-	msg += " Y = " + std::to_string(bodyRefY);
-	msg += " Z = " + std::to_string(bodyRefZ);
-	msg += " Length = " + std::to_string(bodyLength);
-	L_DEBUG(msg, GridUtils::logfile);
-#endif
-
-	// Loop over lines in file
-	while (!file.eof()) {
+	// Binary clouds hold their bounding box and only the part near this rank is read
+	double bbMin[3], bbMax[3];
+	if (io_readInBinaryCloud(_PCpts, geom, g, dCell, bbMin, bbMax))
+	{
+		file.close();
+	}
+	else
+	{
+		// Loop over lines in file
+		while (!file.eof()) {
 
-		// Read in one line of file at a time
-		std::string line_in;	// String to store line in
-		std::istringstream iss;	// Buffer stream to store characters
+			// Read in one line of file at a time
+			std::string line_in;	// String to store line in
+			std::istringstream iss;	// Buffer stream to store characters
 
-		// Get line up to new line separator and put in buffer
-		std::getline(file, line_in, '\n');
-		iss.str(line_in);	// Put line in the buffer
-		iss.seekg(0);		// Reset buffer position to start of buffer
+			// Get line up to new line separator and put in buffer
+			std::getline(file, line_in, '\n');
+			iss.str(line_in);	// Put line in the buffer
+			iss.seekg(0);		// Reset buffer position to start of buffer
 
-		// Add coordinates to data store
-		iss >> tmp_x;
-		iss >> tmp_y;
-		iss >> tmp_z;
+			// Add coordinates to data store
+			iss >> tmp_x;
+			iss >> tmp_y;
+			iss >> tmp_z;
 
-		_PCpts->x.push_back(tmp_x);
-		_PCpts->y.push_back(tmp_y);
+			_PCpts->x.push_back(tmp_x);
+			_PCpts->y.push_back(tmp_y);
 
-		// If running a 2D calculation, only read in x and y coordinates and force z coordinates to match the domain
+			// If running a 2D calculation, only read in x and y coordinates and force z coordinates to match the domain
 #if (L_DIMS == 3)
-		_PCpts->z.push_back(tmp_z);
+			_PCpts->z.push_back(tmp_z);
 #else
-		_PCpts->z.push_back(0);
+			_PCpts->z.push_back(0);
 #endif
 
-		// Insert the ID of the point within this point cloud (needed later for assigning marker IDs)
-		_PCpts->id.push_back(static_cast<int>(_PCpts->id.size()));
-
-	}
-	file.close();
+			// Insert the ID of the point within this point cloud (needed later for assigning marker IDs)
+			_PCpts->id.push_back(static_cast<int>(_PCpts->id.size()));
 
-	// Error if no data
-	if (_PCpts->x.empty() || _PCpts->y.empty() || _PCpts->z.empty())
-		L_ERROR("Failed to read object data from cloud input file.", GridUtils::logfile);
-	else
-		L_INFO("Successfully acquired object data from cloud input file.", GridUtils::logfile);
+		}
+		file.close();
 
+		// Error if no data
+		if (_PCpts->x.empty() || _PCpts->y.empty() || _PCpts->z.empty())
+			L_ERROR("Failed to read object data from cloud input file.", GridUtils::logfile);
+		else
+			L_INFO("Successfully acquired object data from cloud input file.", GridUtils::logfile);
+
+		// Bounding box for scaling
+		bbMin[eXDirection] = *std::min_element(_PCpts->x.begin(), _PCpts->x.end());
+		bbMax[eXDirection] = *std::max_element(_PCpts->x.begin(), _PCpts->x.end());
+		bbMin[eYDirection] = *std::min_element(_PCpts->y.begin(), _PCpts->y.end());
+		bbMax[eYDirection] = *std::max_element(_PCpts->y.begin(), _PCpts->y.end());
+		bbMin[eZDirection] = *std::min_element(_PCpts->z.begin(), _PCpts->z.end());
+		bbMax[eZDirection] = *std::max_element(_PCpts->z.begin(), _PCpts->z.end());
+	}
 
 	// Rescale coordinates to fit into size required
 #ifdef L_CLOUD_DEBUG
 	L_DEBUG("Rescaling...", GridUtils::logfile);
 #endif
 
-	double scale_factor;
-	// Scale slightly smaller as distribution of voxels would be asymmetric if points sit on edge
-	if (geom->scaleDirection == eXDirection)
-	{
-		scale_factor = (bodyLength - 2 * L_SMALL_NUMBER * dCell) /
-			std::fabs(*std::max_element(_PCpts->x.begin(), _PCpts->x.end()) - *std::min_element(_PCpts->x.begin(), _PCpts->x.end()));
-	}
-	else if (geom->scaleDirection == eYDirection)
+	double scale_factor, shift[3];
+	io_getCloudTransform(geom, dCell, bbMin, bbMax, scale_factor, shift);
+
+	// Apply shift and scale to each point to convert to global positions
+	for (a = 0; a < static_cast<int>(_PCpts->x.size()); a++)
 	{
-		scale_factor = (bodyLength - 2 * L_SMALL_NUMBER * dCell) /
-			std::fabs(*std::max_element(_PCpts->y.begin(), _PCpts->y.end()) - *std::min_element(_PCpts->y.begin(), _PCpts->y.end()));
+		_PCpts->x[a] *= scale_factor; _PCpts->x[a] += shift[eXDirection];
+		_PCpts->y[a] *= scale_factor; _PCpts->y[a] += shift[eYDirection];
+#if (L_DIMS == 3)
+		_PCpts->z[a] *= scale_factor; _PCpts->z[a] += shift[eZDirection];
+#endif
 	}
-	else if (geom->scaleDirection == eZDirection)
+
+	// Filter and build
+	io_buildCloudBody(_PCpts, geom, g, dCell);
+}
+
+// *****************************************************************************
+/// \brief	Read in binary point cloud data
+///
+///			Binary clouds start with the 8 characters LUMABPC1 followed by 
+///			the number of cells in X, Y and Z (3 x uint32), a reserved uint32, 
+///			the number of points (uint64), the bounding box minimum and 
+///			maximum (6 x double) and the index of the first point in each 
+///			cell plus one past the last point (uint64 per cell + 1). The 
+///			points follow as X, Y, Z (3 x double) and their position in the
+///			original cloud (uint64) grouped by cell where the cells divide the
+///			bounding box evenly and are numbered with Z fastest. All values 
+///			are little-endian. Scaling uses the bounding box in the header so
+///			each rank only reads the cells near its block. The points read are
+///			returned in their original order so bodies are built exactly as 
+///			from the ASCII cloud. tools/python_scripts/cloudToBinary.py 
+///			converts ASCII clouds.
+///
+///	\param	_PCpts		reference to pointer to empty point cloud data container
+///	\param	geom		structure containing object data as parsed from the config file
+///	\param	g			pointer to grid on which the body is built.
+///	\param	dCell		lattice spacing of the body.
+///	\param	bbMin		returns the minimum X, Y and Z of the whole cloud.
+///	\param	bbMax		returns the maximum X, Y and Z of the whole cloud.
+///	\returns			false if the file is not a binary cloud.
+bool ObjectManager::io_readInBinaryCloud(PCpts*& _PCpts, GeomPacked *geom,
+	GridObj *g, double dCell, double *bbMin, double *bbMax)
+{
+	std::ifstream file;
+	file.open("./input/" + geom->fileName, std::ios::in | std::ios::binary);
+
+	// Check the signature
+	char signature[8] = { 0 };
+	file.read(signature, 8);
+	if (!file || std::string(signature, 8) != "LUMABPC1") return false;
+
+	// Read the header
+	unsigned int numCells[3], reserved;
+	unsigned long long numPts;
+	file.read(reinterpret_cast<char*>(numCells), sizeof(numCells));
+	file.read(reinterpret_cast<char*>(&reserved), sizeof(reserved));
+	file.read(reinterpret_cast<char*>(&numPts), sizeof(numPts));
+	file.read(reinterpret_cast<char*>(bbMin), 3 * sizeof(double));
+	file.read(reinterpret_cast<char*>(bbMax), 3 * sizeof(double));
+	if (!file || numPts == 0 || numCells[0] * numCells[1] * numCells[2] == 0)
+		L_ERROR("Failed to read header from binary cloud input file: " + geom->fileName + ". Exiting.", GridUtils::logfile);
+
+	std::vector<unsigned long long> cellStart(static_cast<size_t>(numCells[0]) * numCells[1] * numCells[2] + 1);
+	file.read(reinterpret_cast<char*>(cellStart.data()), cellStart.size() * sizeof(unsigned long long));
+	if (!file || cellStart.back() != numPts)
+		L_ERROR("Failed to read cell index from binary cloud input file: " + geom->fileName + ". Exiting.", GridUtils::logfile);
+	std::streamoff dataStart = file.tellg();
+
+	// Only X and Y are read in 2D
+#if (L_DIMS == 2)
+	bbMin[eZDirection] = 0.0;
+	bbMax[eZDirection] = 0.0;
+#endif
+
+	/* Flag the cells in each direction which hold sites of this grid. The
+	 * sites rather than the extent are used as periodic halos may wrap 
+	 * round. Moving BFL bodies read every cell as they may move onto this 
+	 * rank. */
+	std::vector<bool> cellUsed[3];
+	for (int d = 0; d < 3; ++d) cellUsed[d].assign(numCells[d], true);
+	if (!(geom->objtype == eBFLCloud && geom->moveProperty == eMovable))
 	{
-		scale_factor = (bodyLength - 2 * L_SMALL_NUMBER * dCell) /
-		std::fabs(*std::max_element(_PCpts->z.begin(), _PCpts->z.end()) - *std::min_element(_PCpts->z.begin(), _PCpts->z.end()));
+		double scale_factor, shift[3];
+		io_getCloudTransform(geom, dCell, bbMin, bbMax, scale_factor, shift);
+
+		for (int d = 0; d < L_DIMS; ++d)
+		{
+			if (bbMax[d] <= bbMin[d]) continue;
+			double cellSize = (bbMax[d] - bbMin[d]) / numCells[d];
+			std::vector<double> &pos = (d == eXDirection) ? g->XPos : ((d == eYDirection) ? g->YPos : g->ZPos);
+
+			cellUsed[d].assign(numCells[d], false);
+			for (double site : pos)
+			{
+				// Map the site +/- a cell back to the cloud as read
+				int lo = static_cast<int>(std::floor(((site - dCell - shift[d]) / scale_factor - bbMin[d]) / cellSize));
+				int hi = static_cast<int>(std::floor(((site + dCell - shift[d]) / scale_factor - bbMin[d]) / cellSize));
+				for (int n = std::max(lo, 0); n <= std::min(hi, static_cast<int>(numCells[d]) - 1); ++n)
+					cellUsed[d][n] = true;
+			}
+		}
 	}
 
-	// If reference is a centre, shift to centre of voxel
-	double shiftX, shiftY, shiftZ, scaledDistance, startPos;
-	if (geom->isRefXCentre)
+	// Read each run of flagged cells which is contiguous in Z
+	const size_t recordSize = 3 * sizeof(double) + sizeof(unsigned long long);
+	std::vector<char> buffer;
+	std::vector< std::pair<unsigned long long, size_t> > order;
+	for (int i = 0; i < static_cast<int>(numCells[0]); ++i)
 	{
-		bodyRefX += (dCell / 2.0);
-		scaledDistance = scale_factor * 
-			std::fabs(*std::max_element(_PCpts->x.begin(), _PCpts->x.end()) - *std::min_element(_PCpts->x.begin(), _PCpts->x.end()));
-		scaledDistance = std::round(scaledDistance / dCell) * dCell;	// Round to nearest voxel multiple
-		startPos = bodyRefX - (scaledDistance / 2.0);
-		shiftX = startPos - scale_factor * *std::min_element(_PCpts->x.begin(), _PCpts->x.end());
+		for (int j = 0; j < static_cast<int>(numCells[1]); ++j)
+		{
+			if (!cellUsed[0][i] || !cellUsed[1][j]) continue;
+
+			for (int k = 0; k < static_cast<int>(numCells[2]); ++k)
+			{
+				if (!cellUsed[2][k]) continue;
+				int kEnd = k;
+				while (kEnd + 1 < static_cast<int>(numCells[2]) && cellUsed[2][kEnd + 1]) kEnd++;
+
+				size_t cell = k + j * numCells[2] + i * numCells[2] * numCells[1];
+				unsigned long long first = cellStart[cell];
+				unsigned long long last = cellStart[cell + (kEnd - k) + 1];
+				k = kEnd;
+				if (last == first) continue;
+
+				buffer.resize(static_cast<size_t>(last - first) * recordSize);
+				file.seekg(dataStart + static_cast<std::streamoff>(first * recordSize), std::ios::beg);
+				file.read(buffer.data(), buffer.size());
+				if (!file)
+					L_ERROR("Failed to read points from binary cloud input file: " + geom->fileName + ". Exiting.", GridUtils::logfile);
+
+				for (size_t p = 0; p < static_cast<size_t>(last - first); ++p)
+				{
+					double xyz[3];
+					unsigned long long id;
+					std::memcpy(xyz, buffer.data() + p * recordSize, sizeof(xyz));
+					std::memcpy(&id, buffer.data() + p * recordSize + sizeof(xyz), sizeof(id));
+
+					order.emplace_back(id, _PCpts->x.size());
+					_PCpts->x.push_back(xyz[eXDirection]);
+					_PCpts->y.push_back(xyz[eYDirection]);
+#if (L_DIMS == 3)
+					_PCpts->z.push_back(xyz[eZDirection]);
+#else
+					_PCpts->z.push_back(0);
+#endif
+				}
+			}
+		}
 	}
-	else
+	file.close();
+
+	// Restore the original order of the points
+	std::sort(order.begin(), order.end());
+	PCpts *_sorted = new PCpts();
+	for (auto &pt : order)
 	{
-		shiftX = (bodyRefX + L_SMALL_NUMBER * dCell) - scale_factor * *std::min_element(_PCpts->x.begin(), _PCpts->x.end());
+		_sorted->x.push_back(_PCpts->x[pt.second]);
+		_sorted->y.push_back(_PCpts->y[pt.second]);
+		_sorted->z.push_back(_PCpts->z[pt.second]);
+		_sorted->id.push_back(static_cast<int>(pt.first));
 	}
+	delete _PCpts;
+	_PCpts = _sorted;
+
+	L_INFO("Successfully acquired " + std::to_string(_PCpts->x.size()) + " of " + 
+		std::to_string(numPts) + " points from binary cloud input file.", GridUtils::logfile);
+	return true;
+}
+
+// *****************************************************************************
+/// \brief	Get the extent of a grid on this rank.
+///
+///			Halos may wrap periodically so the positions are searched rather
+///			than taking the first and last. Z is set to zero in 2D.
+///
+///	\param	g			pointer to grid.
+///	\param	margin		distance added either side.
+///	\param	rankMin		returns the minimum X, Y and Z.
+///	\param	rankMax		returns the maximum X, Y and Z.
+void ObjectManager::io_getRankExtent(GridObj *g, double margin, double *rankMin, double *rankMax)
+{
+	rankMin[eXDirection] = *std::min_element(g->XPos.begin(), g->XPos.end()) - margin;
+	rankMax[eXDirection] = *std::max_element(g->XPos.begin(), g->XPos.end()) + margin;
+	rankMin[eYDirection] = *std::min_element(g->YPos.begin(), g->YPos.end()) - margin;
+	rankMax[eYDirection] = *std::max_element(g->YPos.begin(), g->YPos.end()) + margin;
+#if (L_DIMS == 3)
+	rankMin[eZDirection] = *std::min_element(g->ZPos.begin(), g->ZPos.end()) - margin;
+	rankMax[eZDirection] = *std::max_element(g->ZPos.begin(), g->ZPos.end()) + margin;
+#else
+	rankMin[eZDirection] = 0.0;
+	rankMax[eZDirection] = 0.0;
+#endif
+}
+
+// *****************************************************************************
+/// \brief	Read in triangle mesh data
+///
+///			Input data must be an STL (binary or ASCII) or OBJ file in the 
+///			input directory. The mesh is placed in the same way as a point 
+///			cloud. BBB bodies are voxelised from the closed surface. IBM and 
+///			BFL bodies are built from points sampled on the surface near this 
+///			rank and BFL bodies compute Q from the mesh itself. In 2D the mesh
+///			is sliced through the middle of its extent in Z.
+///
+///	\param	geom		structure containing object data as parsed from the config file
+void ObjectManager::io_readInMesh(GeomPacked *geom)
+{
+	double dCell;
+	GridObj* g = NULL;
 
-	if (geom->isRefYCentre)
+	// If the level is set to -1 then object can span levels
+	if (geom->onGridLev < 0)
 	{
-		bodyRefY += (dCell / 2.0);
-		scaledDistance = scale_factor *
-			std::fabs(*std::max_element(_PCpts->y.begin(), _PCpts->y.end()) - *std::min_element(_PCpts->y.begin(), _PCpts->y.end()));
-		scaledDistance = std::round(scaledDistance / dCell) * dCell;
-		startPos = bodyRefY - (scaledDistance / 2.0);
-		shiftY = startPos - scale_factor * *std::min_element(_PCpts->y.begin(), _PCpts->y.end());
+		// For scaling use the finest grid scale
+		dCell = _Grids[0].dh / pow(2, L_NUM_LEVELS);
+
+		// For range checking use the coarsest grid
+		g = _Grids;
 	}
 	else
 	{
-		shiftY = (bodyRefY + L_SMALL_NUMBER * dCell) - scale_factor * *std::min_element(_PCpts->y.begin(), _PCpts->y.end());
+		// Get required grid pointer
+		GridUtils::getGrid(_Grids, geom->onGridLev, geom->onGridReg, g);
+
+		// Return if this process does not have this grid
+		if (g == NULL) return;
+
+		// Set scaling
+		dCell = g->dh;
 	}
 
-	if (geom->isRefZCentre)
+	// Read in the triangles
+	TriMesh mesh;
+	if (!mesh.read("./input/" + geom->fileName))
+		L_ERROR("Failed to read triangles from mesh input file: " + geom->fileName + ". Exiting.", GridUtils::logfile);
+	else
+		L_INFO("Successfully acquired " + std::to_string(mesh.size()) + " triangles from mesh input file.", GridUtils::logfile);
+
+	// Place the mesh
+	double bbMin[3], bbMax[3], scale_factor, shift[3];
+	mesh.getBoundingBox(bbMin, bbMax);
+	io_getCloudTransform(geom, dCell, bbMin, bbMax, scale_factor, shift);
+#if (L_DIMS == 2)
+	shift[eZDirection] = -scale_factor * 0.5 * (bbMin[eZDirection] + bbMax[eZDirection]);
+#endif
+	mesh.transform(scale_factor, shift);
+
+	// Extent of the grid on this rank
+	double rankMin[3], rankMax[3];
+	io_getRankExtent(g, dCell, rankMin, rankMax);
+
+	// BBB bodies are voxelised directly
+	if (geom->objtype == eBBBCloud)
 	{
-		bodyRefZ += (dCell / 2.0);
-		scaledDistance = scale_factor *
-			std::fabs(*std::max_element(_PCpts->z.begin(), _PCpts->z.end()) - *std::min_element(_PCpts->z.begin(), _PCpts->z.end()));
-		scaledDistance = std::round(scaledDistance / dCell) * dCell;
-		startPos = bodyRefZ - (scaledDistance / 2.0);
-		shiftZ = startPos - scale_factor * *std::min_element(_PCpts->z.begin(), _PCpts->z.end());
+		L_INFO("Building body on this rank...", GridUtils::logfile);
+		if (geom->onGridLev < 0)
+			addBouncebackObject(geom, mesh);		// Can cross over grid levels
+		else
+			addBouncebackObject(g, geom, mesh);
+		return;
 	}
+
+	// Moving BFL bodies keep the whole surface in case they move onto this rank
+	bool bWholeSurface = (geom->objtype == eBFLCloud && geom->moveProperty == eMovable);
+	if (!bWholeSurface)
+		mesh.cull(rankMin, rankMax);
 	else
+		mesh.getBoundingBox(rankMin, rankMax);
+
+	// Sample the surface finely enough to give every cut voxel a point
+	PCpts *_PCpts = new PCpts();
+	mesh.sampleSurface(dCell / 2.0, rankMin, rankMax, _PCpts);
+
+	// Filter and build
+	io_buildCloudBody(_PCpts, geom, g, dCell, (geom->objtype == eBFLCloud) ? &mesh : nullptr);
+	delete _PCpts;
+}
+
+// *****************************************************************************
+/// \brief	Get the scale and shift which place a body read from file.
+///
+///			The body is scaled to the length given in the config file in the
+///			scaling direction and positioned using the reference values 
+///			rounded to a whole number of voxels.
+///
+///	\param	geom			structure containing object data as parsed from the config file
+///	\param	dCell			lattice spacing used for rounding.
+///	\param	bbMin			minimum X, Y and Z of the body as read.
+///	\param	bbMax			maximum X, Y and Z of the body as read.
+///	\param	scale_factor	returns the scale factor.
+///	\param	shift			returns the shift in X, Y and Z applied after scaling.
+void ObjectManager::io_getCloudTransform(GeomPacked *geom, double dCell,
+	const double *bbMin, const double *bbMax, double &scale_factor, double *shift)
+{
+	// Round reference values to complete number of voxels as measured from origin
+	double bodyRef[3];
+	bodyRef[eXDirection] = std::round(geom->bodyRefX / dCell) * dCell;
+	bodyRef[eYDirection] = std::round(geom->bodyRefY / dCell) * dCell;
+	bodyRef[eZDirection] = std::round(geom->bodyRefZ / dCell) * dCell;
+	double bodyLength = std::round(geom->bodyLength / dCell) * dCell;
+	bool isRefCentre[3] = { geom->isRefXCentre, geom->isRefYCentre, geom->isRefZCentre };
+
+	// Write the scaled reference data
+#ifdef L_CLOUD_DEBUG
+	std::string msg("Scaled reference values are:");
+	msg += " X = " + std::to_string(bodyRef[eXDirection]);
+	msg += " Y = " + std::to_string(bodyRef[eYDirection]);
+	msg += " Z = " + std::to_string(bodyRef[eZDirection]);
+	msg += " Length = " + std::to_string(bodyLength);
+	L_DEBUG(msg, GridUtils::logfile);
+#endif
+
+	// Scale slightly smaller as distribution of voxels would be asymmetric if points sit on edge
+	scale_factor = (bodyLength - 2 * L_SMALL_NUMBER * dCell) /
+		std::fabs(bbMax[geom->scaleDirection] - bbMin[geom->scaleDirection]);
+
+	for (int d = 0; d < 3; ++d)
 	{
-		shiftZ = (bodyRefZ + L_SMALL_NUMBER * dCell) - scale_factor * *std::min_element(_PCpts->z.begin(), _PCpts->z.end());
+		// If reference is a centre, shift to centre of voxel
+		if (isRefCentre[d])
+		{
+			bodyRef[d] += (dCell / 2.0);
+			double scaledDistance = scale_factor * std::fabs(bbMax[d] - bbMin[d]);
+			scaledDistance = std::round(scaledDistance / dCell) * dCell;	// Round to nearest voxel multiple
+			double startPos = bodyRef[d] - (scaledDistance / 2.0);
+			shift[d] = startPos - scale_factor * bbMin[d];
+		}
+		else
+		{
+			shift[d] = (bodyRef[d] + L_SMALL_NUMBER * dCell) - scale_factor * bbMin[d];
+		}
 	}
+}
 
+// *****************************************************************************
+/// \brief	Filter the points of a placed body to this rank and build it.
+///
+///	\param	_PCpts		reference to pointer to point cloud in global positions
+///	\param	geom		structure containing object data as parsed from the config file
+///	\param	g			pointer to grid on which the body is built.
+///	\param	dCell		lattice spacing of the body.
+///	\param	mesh		surface mesh the points were sampled from (if any).
+void ObjectManager::io_buildCloudBody(PCpts*& _PCpts, GeomPacked *geom,
+	GridObj *g, double dCell, const TriMesh *mesh)
+{
 	// Declare local indices
 	std::vector<int> ijk;
 	eLocationOnRank loc = eNone;
@@ -974,16 +1283,14 @@ void ObjectManager::io_readInCloud(PCpts*& _PCpts, GeomPacked *geom)
 	// Filter: erase is O(n^2) so create a copy instead
 	PCpts *_filtered = new PCpts();
 
-	// Apply shift and scale to each point to convert to global positions
-	for (a = 0; a < static_cast<int>(_PCpts->x.size()); a++)
-	{
-		_PCpts->x[a] *= scale_factor; _PCpts->x[a] += shiftX;
-		_PCpts->y[a] *= scale_factor; _PCpts->y[a] += shiftY;
-#if (L_DIMS == 3)
-		_PCpts->z[a] *= scale_factor; _PCpts->z[a] += shiftZ;
-#endif
+	// Points which are not on this rank kept for moving BFL bodies
+	bool bKeepOffRank = (geom->objtype == eBFLCloud && geom->moveProperty == eMovable);
+	PCpts *_offRank = new PCpts();
+	std::unordered_map<long long, int> offRankBins;
 
-		// Apply a rank filter at the same time
+	// Filter the points to this rank
+	for (size_t a = 0; a < _PCpts->x.size(); a++)
+	{
 		if (GridUtils::isOnThisRank(_PCpts->x[a], _PCpts->y[a], _PCpts->z[a], &loc, g))
 		{
 			_filtered->x.push_back(_PCpts->x[a]);
@@ -992,6 +1299,25 @@ void ObjectManager::io_readInCloud(PCpts*& _PCpts, GeomPacked *geom)
 			_filtered->id.push_back(_PCpts->id[a]);
 		}
 
+		/* Moving BFL bodies may move onto this rank so also keep one point 
+		 * per lattice-sized bin of the points which are not on it. */
+		else if (bKeepOffRank)
+		{
+			// Pack the bin indices into one key (assumes fewer than 2^20 bins in each direction)
+			const long long nBins = 1 << 20;
+			long long key =
+				((static_cast<long long>(std::floor(_PCpts->x[a] / dCell)) + nBins / 2) * nBins +
+				(static_cast<long long>(std::floor(_PCpts->y[a] / dCell)) + nBins / 2)) * nBins +
+				(static_cast<long long>(std::floor(_PCpts->z[a] / dCell)) + nBins / 2);
+			if (offRankBins.emplace(key, static_cast<int>(_offRank->x.size())).second)
+			{
+				_offRank->x.push_back(_PCpts->x[a]);
+				_offRank->y.push_back(_PCpts->y[a]);
+				_offRank->z.push_back(_PCpts->z[a]);
+				_offRank->id.push_back(_PCpts->id[a]);
+			}
+		}
+
 	}
 
 	// Free old array and assign new array to pointer which will be passed back out
@@ -1014,7 +1340,7 @@ void ObjectManager::io_readInCloud(PCpts*& _PCpts, GeomPacked *geom)
 #endif	
 
 	// If there are points left
-	if (!_PCpts->x.empty() && geom->objtype != eIBBCloud)
+	if ((!_PCpts->x.empty() || !_offRank->x.empty()) && geom->objtype != eIBBCloud)
 	{
 
 		L_INFO("Building body on this rank...", GridUtils::logfile);
@@ -1035,7 +1361,11 @@ void ObjectManager::io_readInCloud(PCpts*& _PCpts, GeomPacked *geom)
 		case eBFLCloud:
 
 			// Call constructor to build BFL body
-			pBody.emplace_back(g, geom->bodyID, _PCpts);
+			if (mesh)
+				pBody.emplace_back(g, geom->bodyID, _PCpts, geom->moveProperty, *mesh);
+			else
+				pBody.emplace_back(g, geom->bodyID, _PCpts, geom->moveProperty);
+			if (bKeepOffRank) pBody.back().addReferencePoints(_offRank);
 			break;
 		}
 	}
@@ -1044,6 +1374,8 @@ void ObjectManager::io_readInCloud(PCpts*& _PCpts, GeomPacked *geom)
 		// Call constructor to build IBM body
 		iBody.emplace_back(g, geom->bodyID, _PCpts, geom->moveProperty);
 	}
+
+	delete _offRank;
 }
 
 
@@ -1099,8 +1431,9 @@ void ObjectManager::io_writeForcesOnObjects(double tval) {
 	// Search for bodies on this rank
 	for (BFLBody& body : objman->pBody)
 	{
-		// Filename
-		fileName << GridUtils::path_str + "/LiftDragBFL_Rnk" << rank << ".csv";
+		// Filename (one per body)
+		fileName.str("");
+		fileName << GridUtils::path_str + "/LiftDragBFL_Body" << body.id << "_Rnk" << rank << ".csv";
 
 		// Open file
 		fout.open(fileName.str().c_str(), std::ios::out | std::ios::app);
@@ -1239,3 +1572,42 @@ void ObjectManager::io_writeTipPositions(int tval) {
 		fout.close();
 	}
 }
+
+// *****************************************************************************
+/// \brief	Write out the measured cost of IBM markers to the log.
+///
+///			Uses the time-averaged phase timers on each grid to express the cost
+///			of the IBM steps per marker in units of a site update. The value can
+///			be used to calibrate L_MPI_SD_COST_IBM for the decomposition.
+void ObjectManager::io_writeCostCalibration() {
+
+	// Loop over grids on this rank
+	for (int lev = 0; lev <= L_NUM_LEVELS; ++lev) {
+		if (!hasIBMBodies[lev]) continue;
+
+		for (int reg = 0; reg < L_NUM_REGIONS; ++reg) {
+
+			// Get the grid
+			GridObj *g = NULL;
+			GridUtils::getGrid(_Grids, lev, reg, g);
+			if (g == NULL) continue;
+
+			// Count the markers held on this grid
+			size_t numMarkers = 0;
+			for (size_t ib = 0; ib < iBody.size(); ++ib) {
+				if (iBody[ib]._Owner == g)
+					numMarkers += iBody[ib].markers.size();
+			}
+			if (numMarkers == 0 || g->timeav_ibm <= 0.0) continue;
+
+			// Cost of a marker relative to a site update
+			double siteTime = (g->timeav_timestep - g->timeav_ibm) / (g->N_lim * g->M_lim * g->K_lim);
+			double markerTime = g->timeav_ibm / numMarkers;
+			if (siteTime <= 0.0) continue;
+
+			L_INFO("Grid " + std::to_string(lev) + " region " + std::to_string(reg) + 
+				": measured IBM cost of " + std::to_string(markerTime / siteTime) + 
+				" site updates per marker (L_MPI_SD_COST_IBM = " + std::to_string(L_MPI_SD_COST_IBM) + ").", GridUtils::logfile);
+		}
+	}
+}
@@ -0,0 +1,491 @@
+/*
+* --------------------------------------------------------------
+*
+* ------ Lattice Boltzmann @ The University of Manchester ------
+*
+* -------------------------- L-U-M-A ---------------------------
+*
+* Copyright 2018 The University of Manchester
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.*
+*/
+
+#include "../inc/stdafx.h"
+#include "../inc/TriMesh.h"
+#include "../inc/PCpts.h"
+
+
+// *****************************************************************************
+/// \brief	Check whether a file is a triangle mesh from its extension.
+///
+/// \param	fileName	name of file.
+/// \returns			true if the extension is .stl or .obj (any case).
+bool TriMesh::isMeshFile(const std::string &fileName)
+{
+	size_t dot = fileName.find_last_of('.');
+	if (dot == std::string::npos) return false;
+
+	std::string ext = fileName.substr(dot + 1);
+	std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+	return (ext == "stl" || ext == "obj");
+}
+
+// *****************************************************************************
+/// \brief	Read in a triangle mesh.
+///
+///			OBJ files are read as text. STL files are read as binary if the
+///			file size matches the triangle count in the binary header,
+///			otherwise as ASCII. Any existing triangles are discarded.
+///
+/// \param	fileName	path to file.
+/// \returns			true if any triangles were read.
+bool TriMesh::read(const std::string &fileName)
+{
+	tri.clear();
+	bins.clear();
+
+	std::ifstream file(fileName, std::ios::in | std::ios::binary);
+	if (!file.is_open()) return false;
+
+	size_t dot = fileName.find_last_of('.');
+	std::string ext = fileName.substr(dot + 1);
+	std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+
+	if (ext == "obj")
+		return readOBJ(file);
+	else if (readBinarySTL(file))
+		return true;
+
+	file.clear();
+	file.seekg(0, std::ios::beg);
+	return readAsciiSTL(file);
+}
+
+// *****************************************************************************
+/// \brief	Read a binary STL file.
+///
+///			Records are 50 bytes: a normal and three vertices as 32-bit floats
+///			followed by a 2-byte attribute. All records are read in one go.
+///
+/// \param	file	open file stream.
+/// \returns		false if the file is not a valid binary STL file.
+bool TriMesh::readBinarySTL(std::ifstream &file)
+{
+	// File size must match the triangle count in the header
+	file.seekg(0, std::ios::end);
+	std::streamoff fileSize = file.tellg();
+	if (fileSize < 84) return false;
+
+	char header[84];
+	file.seekg(0, std::ios::beg);
+	file.read(header, 84);
+	unsigned int numTri;
+	std::memcpy(&numTri, header + 80, 4);
+	if (numTri == 0 || fileSize != 84 + 50 * static_cast<std::streamoff>(numTri)) return false;
+
+	// Read the records
+	std::vector<char> buffer(50 * static_cast<size_t>(numTri));
+	file.read(buffer.data(), buffer.size());
+	if (!file) return false;
+
+	tri.resize(9 * static_cast<size_t>(numTri));
+	float vert[9];
+	for (size_t t = 0; t < numTri; ++t)
+	{
+		std::memcpy(vert, buffer.data() + 50 * t + 12, 36);
+		for (int n = 0; n < 9; ++n)
+			tri[9 * t + n] = static_cast<double>(vert[n]);
+	}
+
+	return true;
+}
+
+// *****************************************************************************
+/// \brief	Read an ASCII STL file.
+///
+/// \param	file	open file stream.
+/// \returns		true if any triangles were read.
+bool TriMesh::readAsciiSTL(std::ifstream &file)
+{
+	std::string word;
+	double x, y, z;
+	while (file >> word)
+	{
+		if (word == "vertex")
+		{
+			file >> x >> y >> z;
+			tri.push_back(x);
+			tri.push_back(y);
+			tri.push_back(z);
+		}
+	}
+
+	// Discard any incomplete triangle
+	tri.resize(tri.size() - tri.size() % 9);
+	return !tri.empty();
+}
+
+// *****************************************************************************
+/// \brief	Read an OBJ file.
+///
+///			Only vertices and faces are used. Polygonal faces are split into a
+///			fan of triangles and negative (relative) indices are supported.
+///
+/// \param	file	open file stream.
+/// \returns		true if any triangles were read.
+bool TriMesh::readOBJ(std::ifstream &file)
+{
+	std::vector<double> vert;
+	std::string line_in, tag, token;
+	std::vector<int> face;
+
+	while (std::getline(file, line_in))
+	{
+		std::istringstream iss(line_in);
+		if (!(iss >> tag)) continue;
+
+		if (tag == "v")
+		{
+			double x = 0.0, y = 0.0, z = 0.0;
+			iss >> x >> y >> z;
+			vert.push_back(x);
+			vert.push_back(y);
+			vert.push_back(z);
+		}
+		else if (tag == "f")
+		{
+			// Vertex index is the first field of each v/vt/vn token
+			face.clear();
+			int numVert = static_cast<int>(vert.size() / 3);
+			while (iss >> token)
+			{
+				int idx = std::atoi(token.substr(0, token.find('/')).c_str());
+				idx = (idx < 0) ? numVert + idx : idx - 1;
+				if (idx < 0 || idx >= numVert) return false;
+				face.push_back(idx);
+			}
+
+			for (size_t n = 1; n + 1 < face.size(); ++n)
+			{
+				tri.insert(tri.end(), vert.begin() + 3 * face[0], vert.begin() + 3 * face[0] + 3);
+				tri.insert(tri.end(), vert.begin() + 3 * face[n], vert.begin() + 3 * face[n] + 3);
+				tri.insert(tri.end(), vert.begin() + 3 * face[n + 1], vert.begin() + 3 * face[n + 1] + 3);
+			}
+		}
+	}
+
+	return !tri.empty();
+}
+
+// *****************************************************************************
+/// \brief	Get the bounding box of the vertices.
+///
+/// \param	bbMin	returns the minimum X, Y and Z.
+/// \param	bbMax	returns the maximum X, Y and Z.
+void TriMesh::getBoundingBox(double *bbMin, double *bbMax) const
+{
+	for (int d = 0; d < 3; ++d)
+	{
+		bbMin[d] = std::numeric_limits<double>::max();
+		bbMax[d] = -std::numeric_limits<double>::max();
+	}
+
+	for (size_t n = 0; n < tri.size(); ++n)
+	{
+		bbMin[n % 3] = std::min(bbMin[n % 3], tri[n]);
+		bbMax[n % 3] = std::max(bbMax[n % 3], tri[n]);
+	}
+}
+
+// *****************************************************************************
+/// \brief	Scale then shift the vertices.
+///
+///	\param	scale	scale factor.
+///	\param	shift	shift in X, Y and Z applied after scaling.
+void TriMesh::transform(double scale, const double *shift)
+{
+	for (size_t n = 0; n < tri.size(); ++n)
+	{
+		tri[n] *= scale;
+		tri[n] += shift[n % 3];
+	}
+	bins.clear();
+}
+
+// *****************************************************************************
+/// \brief	Remove the triangles which do not overlap a box.
+///
+///	\param	bbMin	minimum X, Y and Z of box.
+///	\param	bbMax	maximum X, Y and Z of box.
+void TriMesh::cull(const double *bbMin, const double *bbMax)
+{
+	size_t kept = 0;
+	for (size_t t = 0; t < size(); ++t)
+	{
+		bool bOverlaps = true;
+		for (int d = 0; d < 3; ++d)
+		{
+			double lo = std::min(tri[9 * t + d], std::min(tri[9 * t + 3 + d], tri[9 * t + 6 + d]));
+			double hi = std::max(tri[9 * t + d], std::max(tri[9 * t + 3 + d], tri[9 * t + 6 + d]));
+			if (hi < bbMin[d] || lo > bbMax[d]) bOverlaps = false;
+		}
+
+		if (bOverlaps)
+		{
+			std::copy(tri.begin() + 9 * t, tri.begin() + 9 * t + 9, tri.begin() + 9 * kept);
+			kept++;
+		}
+	}
+	tri.resize(9 * kept);
+	bins.clear();
+}
+
+// *****************************************************************************
+/// \brief	Bin the triangles by their extent in the Y-Z plane.
+///
+///	\param	spacing	size of the square bins.
+void TriMesh::buildBins(double spacing)
+{
+	bins.clear();
+	if (empty()) return;
+
+	double bbMin[3], bbMax[3];
+	getBoundingBox(bbMin, bbMax);
+
+	binSize = spacing;
+	for (int d = 0; d < 2; ++d)
+	{
+		binOrigin[d] = bbMin[d + 1];
+		numBins[d] = static_cast<int>(std::floor((bbMax[d + 1] - bbMin[d + 1]) / binSize)) + 1;
+	}
+	bins.resize(static_cast<size_t>(numBins[0]) * numBins[1]);
+
+	int range[4];
+	for (size_t t = 0; t < size(); ++t)
+	{
+		const double *v = &tri[9 * t];
+		getBinRange(
+			std::min(v[1], std::min(v[4], v[7])), std::max(v[1], std::max(v[4], v[7])),
+			std::min(v[2], std::min(v[5], v[8])), std::max(v[2], std::max(v[5], v[8])),
+			range);
+
+		for (int by = range[0]; by <= range[1]; ++by)
+		{
+			for (int bz = range[2]; bz <= range[3]; ++bz)
+				bins[bz + by * numBins[1]].push_back(static_cast<int>(t));
+		}
+	}
+}
+
+// *****************************************************************************
+/// \brief	Get the bins overlapped by a Y-Z rectangle.
+///
+///			The range is empty (lower bound above upper) if the rectangle
+///			misses the bins entirely.
+///
+///	\param	yMin	minimum Y of rectangle.
+///	\param	yMax	maximum Y of rectangle.
+///	\param	zMin	minimum Z of rectangle.
+///	\param	zMax	maximum Z of rectangle.
+///	\param	range	returns first and last bin in Y then first and last bin in Z.
+void TriMesh::getBinRange(double yMin, double yMax, double zMin, double zMax, int *range) const
+{
+	double lo[2] = { yMin, zMin };
+	double hi[2] = { yMax, zMax };
+	for (int d = 0; d < 2; ++d)
+	{
+		range[2 * d] = std::max(0, static_cast<int>(std::floor((lo[d] - binOrigin[d]) / binSize)));
+		range[2 * d + 1] = std::min(numBins[d] - 1, static_cast<int>(std::floor((hi[d] - binOrigin[d]) / binSize)));
+	}
+}
+
+// *****************************************************************************
+/// \brief	Get the positions where a ray in the X-direction crosses the surface.
+///
+///			The ray is nudged by a tiny fraction of a bin so that it does not
+///			pass exactly through an edge or vertex which would otherwise be
+///			counted by both neighbouring triangles. For a closed surface a
+///			point is inside if an odd number of crossings lie below it.
+///
+///	\param	y		Y-position of ray.
+///	\param	z		Z-position of ray.
+///	\param	xCross	returns the sorted X-positions of the crossings.
+void TriMesh::getRayCrossings(double y, double z, std::vector<double> &xCross) const
+{
+	xCross.clear();
+	if (bins.empty()) return;
+
+	y += 1.234567e-7 * binSize;
+	z += 2.345678e-7 * binSize;
+
+	int range[4];
+	getBinRange(y, y, z, z, range);
+	if (range[0] > range[1] || range[2] > range[3]) return;
+
+	for (int t : bins[range[2] + range[0] * numBins[1]])
+	{
+		const double *a = &tri[9 * t];
+		const double *b = a + 3;
+		const double *c = a + 6;
+
+		// Barycentric coordinates of the ray in the Y-Z projection of the triangle
+		double det = (b[1] - a[1]) * (c[2] - a[2]) - (c[1] - a[1]) * (b[2] - a[2]);
+		if (det == 0.0) continue;
+
+		double wb = ((y - a[1]) * (c[2] - a[2]) - (c[1] - a[1]) * (z - a[2])) / det;
+		double wc = ((b[1] - a[1]) * (z - a[2]) - (y - a[1]) * (b[2] - a[2])) / det;
+		double wa = 1.0 - wb - wc;
+		if (wa < 0.0 || wb < 0.0 || wc < 0.0) continue;
+
+		xCross.push_back(wa * a[0] + wb * b[0] + wc * c[0]);
+	}
+
+	std::sort(xCross.begin(), xCross.end());
+}
+
+// *****************************************************************************
+/// \brief	Intersect a segment with the surface.
+///
+///			Uses the Moller-Trumbore ray-triangle test on the triangles in
+///			the bins overlapped by the segment.
+///
+///	\param	p0	start of segment.
+///	\param	p1	end of segment.
+///	\returns	fraction along the segment of the nearest crossing or -1 if none.
+double TriMesh::intersectSegment(const double *p0, const double *p1) const
+{
+	if (bins.empty()) return -1.0;
+
+	int range[4];
+	getBinRange(std::min(p0[1], p1[1]), std::max(p0[1], p1[1]),
+		std::min(p0[2], p1[2]), std::max(p0[2], p1[2]), range);
+
+	double dir[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+	double tMin = -1.0;
+
+	for (int by = range[0]; by <= range[1]; ++by)
+	{
+		for (int bz = range[2]; bz <= range[3]; ++bz)
+		{
+			for (int t : bins[bz + by * numBins[1]])
+			{
+				const double *a = &tri[9 * t];
+				double e1[3] = { a[3] - a[0], a[4] - a[1], a[5] - a[2] };
+				double e2[3] = { a[6] - a[0], a[7] - a[1], a[8] - a[2] };
+
+				double h[3] = {
+					dir[1] * e2[2] - dir[2] * e2[1],
+					dir[2] * e2[0] - dir[0] * e2[2],
+					dir[0] * e2[1] - dir[1] * e2[0] };
+				double det = e1[0] * h[0] + e1[1] * h[1] + e1[2] * h[2];
+				if (det == 0.0) continue;
+
+				double s[3] = { p0[0] - a[0], p0[1] - a[1], p0[2] - a[2] };
+				double u = (s[0] * h[0] + s[1] * h[1] + s[2] * h[2]) / det;
+				if (u < 0.0 || u > 1.0) continue;
+
+				double q[3] = {
+					s[1] * e1[2] - s[2] * e1[1],
+					s[2] * e1[0] - s[0] * e1[2],
+					s[0] * e1[1] - s[1] * e1[0] };
+				double v = (dir[0] * q[0] + dir[1] * q[1] + dir[2] * q[2]) / det;
+				if (v < 0.0 || u + v > 1.0) continue;
+
+				double tHit = (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]) / det;
+				if (tHit >= 0.0 && tHit <= 1.0 && (tMin < 0.0 || tHit < tMin))
+					tMin = tHit;
+			}
+		}
+	}
+
+	return tMin;
+}
+
+// *****************************************************************************
+/// \brief	Generate points on the surface inside a box.
+///
+///			In 3D each triangle is sampled on a regular barycentric grid. In
+///			2D the surface is sliced by the plane Z = 0 and each slice segment
+///			is sampled instead. Points are appended to the point cloud with
+///			Z = 0 in 2D.
+///
+///	\param	spacing	maximum spacing between points.
+///	\param	bbMin	minimum X, Y and Z of box.
+///	\param	bbMax	maximum X, Y and Z of box.
+///	\param	_PCpts	point cloud to which points are added.
+void TriMesh::sampleSurface(double spacing, const double *bbMin, const double *bbMax, PCpts *_PCpts) const
+{
+	std::vector<double> pts;
+
+	for (size_t t = 0; t < size(); ++t)
+	{
+		const double *a = &tri[9 * t];
+
+#if (L_DIMS == 3)
+		// Sample triangle on a grid fine enough for its longest edge
+		double len = std::max(GridUtils::vecnorm(a[3] - a[0], a[4] - a[1], a[5] - a[2]),
+			std::max(GridUtils::vecnorm(a[6] - a[0], a[7] - a[1], a[8] - a[2]),
+				GridUtils::vecnorm(a[6] - a[3], a[7] - a[4], a[8] - a[5])));
+		int n = std::max(1, static_cast<int>(std::ceil(len / spacing)));
+		for (int i = 0; i <= n; ++i)
+		{
+			for (int j = 0; j <= n - i; ++j)
+			{
+				for (int d = 0; d < 3; ++d)
+					pts.push_back(a[d] + (a[3 + d] - a[d]) * i / n + (a[6 + d] - a[d]) * j / n);
+			}
+		}
+#else
+		// Slice with Z = 0 (half-open test so a vertex on the plane counts once)
+		double seg[4];
+		int numEnds = 0;
+		for (int e = 0; e < 3 && numEnds < 2; ++e)
+		{
+			const double *p = a + 3 * e;
+			const double *q = a + 3 * ((e + 1) % 3);
+			if ((p[2] <= 0.0) == (q[2] <= 0.0)) continue;
+
+			double f = p[2] / (p[2] - q[2]);
+			seg[2 * numEnds] = p[0] + f * (q[0] - p[0]);
+			seg[2 * numEnds + 1] = p[1] + f * (q[1] - p[1]);
+			numEnds++;
+		}
+		if (numEnds < 2) continue;
+
+		// Sample slice segment
+		int n = std::max(1, static_cast<int>(std::ceil(GridUtils::vecnorm(seg[2] - seg[0], seg[3] - seg[1]) / spacing)));
+		for (int i = 0; i <= n; ++i)
+		{
+			pts.push_back(seg[0] + (seg[2] - seg[0]) * i / n);
+			pts.push_back(seg[1] + (seg[3] - seg[1]) * i / n);
+			pts.push_back(0.0);
+		}
+#endif
+	}
+
+	// Keep points inside the box
+	for (size_t p = 0; p < pts.size(); p += 3)
+	{
+		if (pts[p] < bbMin[0] || pts[p] > bbMax[0] ||
+			pts[p + 1] < bbMin[1] || pts[p + 1] > bbMax[1]
+#if (L_DIMS == 3)
+			|| pts[p + 2] < bbMin[2] || pts[p + 2] > bbMax[2]
+#endif
+			) continue;
+
+		_PCpts->x.push_back(pts[p]);
+		_PCpts->y.push_back(pts[p + 1]);
+		_PCpts->z.push_back(pts[p + 2]);
+		_PCpts->id.push_back(static_cast<int>(_PCpts->id.size()));
+	}
+}
@@ -79,9 +79,24 @@ int main( int argc, char* argv[] )
 
 #ifdef L_BUILD_FOR_MPI
 
+#ifdef L_ENABLE_OPENMP
+
+	// Hybrid initialise requesting the level of thread support the kernel needs
+#ifdef L_MPI_THREAD_MULTIPLE
+	int mpi_thread_required = MPI_THREAD_MULTIPLE;
+#else
+	int mpi_thread_required = MPI_THREAD_FUNNELED;
+#endif
+	int mpi_thread_provided;
+	MPI_Init_thread(&argc, &argv, mpi_thread_required, &mpi_thread_provided);
+
+#else
+
 	// Usual initialise
 	MPI_Init(&argc, &argv);
 
+#endif
+
 #endif
 
 	// Reset the refined region z-limits if only 2D -- must be done before initialising the MPI manager
@@ -105,6 +120,12 @@ int main( int argc, char* argv[] )
     // Timing variables
 	clock_t t_start, secs;	// Wall clock variables
 	double outer_loop_time = 0.0; 
+	double global_loop_time = 0.0;	// Loop time of slowest rank (used for global diagnostics)
+#ifdef L_BUILD_FOR_MPI
+	double loop_time_send = 0.0, loop_time_recv = 0.0;	// Buffers for the non-blocking loop time reduction
+	MPI_Request loop_time_request = MPI_REQUEST_NULL;	// Handle to the pending loop time reduction
+	bool loop_time_reduced = false;						// Flag indicating a global loop time is available
+#endif
 
 	// Start clock to time initialisation
 	t_start = clock();
@@ -201,13 +222,17 @@ int main( int argc, char* argv[] )
 	// Log file information
 	L_INFO("L0 Grid size = " + std::to_string(L_N) + "x" + std::to_string(L_M) + "x" + std::to_string(L_K), GridUtils::logfile);
 #ifdef L_BUILD_FOR_MPI
-	L_INFO("MPI size = " + std::to_string(L_MPI_XCORES) + "x" + std::to_string(L_MPI_YCORES) + "x" + std::to_string(L_MPI_ZCORES), GridUtils::logfile);
+#ifdef L_MPI_RCB_DECOMPOSE
+	L_INFO("MPI size = " + std::to_string(mpim->num_ranks) + " ranks (recursive bisection)", GridUtils::logfile);
+#else
+	L_INFO("MPI size = " + std::to_string(mpim->dimensions[0]) + "x" + std::to_string(mpim->dimensions[1]) + "x" + std::to_string(mpim->dimensions[2]), GridUtils::logfile);
 	*GridUtils::logfile << "Coordinates on rank " << mpim->my_rank << " are (";
 	for (size_t d = 0; d < L_DIMS; d++)
 	{
 		*GridUtils::logfile << "\t" << mpim->rank_coords[d];
 	}
 	*GridUtils::logfile << "\t)" << std::endl;
+#endif
 #endif
 	L_INFO("Number of time steps to run = " + std::to_string(L_TOTAL_TIMESTEPS), GridUtils::logfile);
 	L_INFO("Grid spacing = " + std::to_string(Grids->dh), GridUtils::logfile);
@@ -381,20 +406,15 @@ int main( int argc, char* argv[] )
 #endif
 
 #ifdef L_PROBE_OUTPUT
+	// Wait for previous rank to finish with the file before accessing it
 #ifdef L_BUILD_FOR_MPI
-	for (int n = 0; n < mpim->num_ranks; n++)
+	mpim->mpi_waitForTurn();
 #endif
-	{
-		// Wait for rank accessing the file and only access if this rank's turn
+	L_INFO("Initial probe write out...", GridUtils::logfile);
+	Grids->io_probeOutput();
 #ifdef L_BUILD_FOR_MPI
-		MPI_Barrier(mpim->world_comm);
-		if (mpim->my_rank == n)
+	mpim->mpi_passTurn();
 #endif
-		{
-			L_INFO("Initial probe write out...", GridUtils::logfile);
-			Grids->io_probeOutput();
-		}
-	}
 #endif	// L_PROBE_OUTPUT
 
 #ifdef L_BUILD_FOR_MPI
@@ -403,9 +423,27 @@ int main( int argc, char* argv[] )
 #endif
 
 #ifdef L_ENABLE_OPENMP
-	L_WARN("OpenMP support enabled -- currently experimental!", GridUtils::logfile);
+	L_INFO("OpenMP enabled with " + std::to_string(omp_get_max_threads()) + " threads per process.", GridUtils::logfile);
+#ifdef L_BUILD_FOR_MPI
+	// Check the MPI library can support the threading model in use
+	if (mpi_thread_provided < mpi_thread_required)
+	{
+#ifdef L_MPI_OVERLAP_COMMS
+		L_ERROR("MPI library does not provide the thread support required to overlap communication. "
+			"Rebuild without L_MPI_OVERLAP_COMMS or use a thread-enabled MPI library.", GridUtils::logfile);
+#else
+		L_WARN("MPI library provides less thread support than requested.", GridUtils::logfile);
+#endif
+	}
+#endif
 #endif
 	
+#if (defined L_BUILD_FOR_MPI && defined L_MPI_REBALANCE)
+	// Time spent in the kernel since the last load balance check
+	double rebalance_work_time = 0.0;
+	mpim->comm_time_accum = 0.0;
+#endif
+
 	L_INFO("Initialising LBM time-stepping...", GridUtils::logfile);
 
 	if (rank == 0)
@@ -419,10 +457,9 @@ int main( int argc, char* argv[] )
 	*/
 	do {
 
-		// Synchronise MPI processes before next time step starts
-#ifdef L_BUILD_FOR_MPI
-		MPI_Barrier(mpim->world_comm);
-#endif
+		/* No global synchronisation here -- the halo exchange at the end of each 
+		 * LBM kernel already synchronises each rank with the neighbours it 
+		 * depends on. */
 
 #ifdef L_SHOW_TIME_TO_COMPLETE
 		// Start clock for timing outer loop
@@ -436,7 +473,13 @@ int main( int argc, char* argv[] )
 		// Launch LBM Kernel //
 		///////////////////////
 
+#if (defined L_BUILD_FOR_MPI && defined L_MPI_REBALANCE)
+		double rebalance_start = MPI_Wtime();
 		Grids->LBM_multi_opt();		// Launch LBM kernel on top-level grid
+		rebalance_work_time += MPI_Wtime() - rebalance_start;
+#else
+		Grids->LBM_multi_opt();		// Launch LBM kernel on top-level grid
+#endif
 
 
 		///////////////
@@ -447,12 +490,19 @@ int main( int argc, char* argv[] )
 		if (Grids->t % L_GRID_OUT_FREQ == 0)
 		{
 #ifdef L_BUILD_FOR_MPI
-			MPI_Barrier(mpim->world_comm);
+			/* Collect the slowest-rank loop time from the reduction posted at the 
+			 * previous write out. It has had a whole output interval to complete 
+			 * so this wait should not block. */
+			if (loop_time_request != MPI_REQUEST_NULL) {
+				MPI_Wait(&loop_time_request, MPI_STATUS_IGNORE);
+				global_loop_time = loop_time_recv;
+				loop_time_reduced = true;
+			}
 #endif
 			// Write out the time an outer loop is taking to the log file
 			L_INFO("Outer loop taking " + std::to_string(outer_loop_time) + 
 				"ms. Approximate MLUPS for active sites only = " + 
-				std::to_string(gm->activeCellOps / (outer_loop_time * 1000)),
+				std::to_string(gm->activeCellOps / (global_loop_time * 1000)),
 				GridUtils::logfile);
 
 #ifdef L_TEXTOUT
@@ -496,7 +546,7 @@ int main( int argc, char* argv[] )
 		if (rank == 0 && (Grids->t % L_GRID_OUT_FREQ == 0 || Grids->t < 10))
 		{
 			int hms[3];
-			GridUnits::secs2hms((L_TOTAL_TIMESTEPS - Grids->t) * outer_loop_time / 1000, &hms[0]);
+			GridUnits::secs2hms((L_TOTAL_TIMESTEPS - Grids->t) * global_loop_time / 1000, &hms[0]);
 			if (Grids->t % L_GRID_OUT_FREQ != 0) std::cout << "\r";
 			std::cout << " Time to complete approx. " << hms[0] << " [h] " << hms[1] << " [m] " << hms[2] << " [s]     " << std::flush;
 		}
@@ -526,24 +576,15 @@ int main( int argc, char* argv[] )
 		if (Grids->t % L_PROBE_OUT_FREQ == 0)
 		{
 
+			// Wait for previous rank to finish with the file before accessing it
 #ifdef L_BUILD_FOR_MPI
-			for (int n = 0; n < mpim->num_ranks; n++)
+			mpim->mpi_waitForTurn();
 #endif
-			{
-
-				// Wait for rank accessing the file and only access if this rank's turn
+			L_INFO("Probe write out...", GridUtils::logfile);
+			Grids->io_probeOutput();
 #ifdef L_BUILD_FOR_MPI
-				MPI_Barrier(mpim->world_comm);
-				if (mpim->my_rank == n) 
+			mpim->mpi_passTurn();
 #endif
-				{
-
-					L_INFO("Probe write out...", GridUtils::logfile);
-					Grids->io_probeOutput();
-
-				}
-
-			}
 
 		}
 #endif
@@ -559,6 +600,20 @@ int main( int argc, char* argv[] )
 		}
 
 
+#if (defined L_BUILD_FOR_MPI && defined L_MPI_REBALANCE)
+		////////////////////
+		// Load Balancing //
+		////////////////////
+		if (Grids->t % L_MPI_REBALANCE_FREQ == 0 && Grids->t != L_TOTAL_TIMESTEPS)
+		{
+			// Balance on compute time only as waiting time reflects the imbalance
+			mpim->mpi_rebalance(gm, rebalance_work_time - mpim->comm_time_accum);
+			rebalance_work_time = 0.0;
+			mpim->comm_time_accum = 0.0;
+		}
+#endif
+
+
 #ifdef L_SHOW_TIME_TO_COMPLETE
 		// Update outer loop time (inc. effects of writing out for accuracy)
 		outer_loop_time *= Grids->t - 1;
@@ -566,6 +621,27 @@ int main( int argc, char* argv[] )
 		outer_loop_time /= Grids->t;
 #endif
 
+		// Start the reduction of the slowest-rank loop time for the next write out
+#ifdef L_BUILD_FOR_MPI
+		if (Grids->t % L_GRID_OUT_FREQ == 0) {
+			loop_time_send = outer_loop_time;
+			MPI_Iallreduce(&loop_time_send, &loop_time_recv, 1, MPI_DOUBLE, MPI_MAX, mpim->world_comm, &loop_time_request);
+		}
+		else if (loop_time_request != MPI_REQUEST_NULL) {
+			int flag;
+			MPI_Test(&loop_time_request, &flag, MPI_STATUS_IGNORE);	// Progress the reduction
+			if (flag) {
+				global_loop_time = loop_time_recv;
+				loop_time_reduced = true;
+			}
+		}
+
+		// Use local value until the first reduction has completed
+		if (!loop_time_reduced) global_loop_time = outer_loop_time;
+#else
+		global_loop_time = outer_loop_time;
+#endif
+
 	// Loop End
 	} while (Grids->t < L_TOTAL_TIMESTEPS);
 
@@ -576,6 +652,12 @@ int main( int argc, char* argv[] )
 	****************************************************************************
 	*/
 
+	// Complete any outstanding diagnostic reduction
+#ifdef L_BUILD_FOR_MPI
+	if (loop_time_request != MPI_REQUEST_NULL)
+		MPI_Wait(&loop_time_request, MPI_STATUS_IGNORE);
+#endif
+
 #ifdef L_LOG_TIMINGS
 	// TIMINGS FILE //
 	/* Format is as follows:
@@ -647,6 +729,11 @@ int main( int argc, char* argv[] )
 	}
 
 	// END TIMINGS FILE //
+
+#ifdef L_IBM_ON
+	// Measured IBM cost for calibrating the decomposition cost model
+	objMan->io_writeCostCalibration();
+#endif
 #endif
 
 
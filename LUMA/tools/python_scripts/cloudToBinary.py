@@ -0,0 +1,60 @@
+# Script that converts an ASCII point cloud (3 tab/space separated columns) into the binary point cloud format read by LUMA.
+# The points are grouped into cells which divide the bounding box evenly so that each process only reads the cells near its block.
+# Usage: python cloudToBinary.py input_cloud output_cloud [points_per_cell]
+
+import sys
+import math
+import struct
+
+# Arguments
+finput = sys.argv[1]
+foutput = sys.argv[2]
+ppc = float(sys.argv[3]) if len(sys.argv) > 3 else 64.0
+
+# Read points
+pts = []
+with open(finput, 'r') as f:
+	for line in f:
+		vals = line.split()
+		if len(vals) >= 3:
+			pts.append((float(vals[0]), float(vals[1]), float(vals[2])))
+npts = len(pts)
+bbmin = [min(p[d] for p in pts) for d in range(3)]
+bbmax = [max(p[d] for p in pts) for d in range(3)]
+
+# Number of cells in each direction (one cell in any flat direction)
+extent = [bbmax[d] - bbmin[d] for d in range(3)]
+ndims = max(1, sum(1 for e in extent if e > 0.0))
+nside = max(1, int(round((npts / ppc) ** (1.0 / ndims))))
+ncells = [nside if e > 0.0 else 1 for e in extent]
+
+# Cell of each point numbered with Z fastest
+def cellOf(p):
+	idx = [0, 0, 0]
+	for d in range(3):
+		if extent[d] > 0.0:
+			idx[d] = min(int(math.floor((p[d] - bbmin[d]) / extent[d] * ncells[d])), ncells[d] - 1)
+	return idx[2] + idx[1] * ncells[2] + idx[0] * ncells[2] * ncells[1]
+
+# Group points by cell keeping their position in the file
+cells = [[] for c in range(ncells[0] * ncells[1] * ncells[2])]
+for n, p in enumerate(pts):
+	cells[cellOf(p)].append((p, n))
+cellstart = [0]
+for c in cells:
+	cellstart.append(cellstart[-1] + len(c))
+
+# Write the file
+with open(foutput, 'wb') as f:
+	f.write(b'LUMABPC1')
+	f.write(struct.pack('<3I', *ncells))
+	f.write(struct.pack('<I', 0))
+	f.write(struct.pack('<Q', npts))
+	f.write(struct.pack('<3d', *bbmin))
+	f.write(struct.pack('<3d', *bbmax))
+	f.write(struct.pack('<%dQ' % len(cellstart), *cellstart))
+	for c in cells:
+		for p, n in c:
+			f.write(struct.pack('<3dQ', p[0], p[1], p[2], n))
+
+print('Wrote %d points in %d x %d x %d cells to %s' % (npts, ncells[0], ncells[1], ncells[2], foutput))